@@ -0,0 +1,620 @@
+// bench/allocator_suite.cpp
+#include <fmt/core.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <memory_resource>
+#include <thread>
+#include <vector>
+#include "bench_harness.hpp"
+#include "../src/LinearAllocator/ConcurrentLinearAllocator.hpp"
+#include "../src/LinearAllocator/OwningArena.hpp"
+#include "../src/LinearAllocator/ScratchArena.hpp"
+#include "../src/LinearAllocator/StaticLinearAllocator.hpp"
+#include "../src/LinearAllocator/ThreadArena.hpp"
+
+/**
+ * @brief Operations timed in one repetition of a single-threaded case
+ */
+constexpr size_t kOps = 4096;
+
+/**
+ * @brief Timed repetitions of a single-threaded case, the fastest one is reported
+ */
+constexpr int kRepetitions = 50;
+
+/**
+ * @brief Allocations per thread in one repetition of a multi-threaded case
+ */
+constexpr size_t kThreadOps = 1 << 16;
+
+/**
+ * @brief Allocations between two frees (or resets) in the multi-threaded cases
+ */
+constexpr size_t kBatch = 256;
+
+/**
+ * @brief Timed repetitions of a multi-threaded case
+ */
+constexpr int kThreadRepetitions = 5;
+
+/**
+ * @brief malloc with an alignment, using aligned_alloc above what malloc guarantees
+ */
+void* aligned_malloc(size_t size, size_t alignment) {
+    if (alignment <= alignof(std::max_align_t)) {
+        return std::malloc(size);
+    }
+    return std::aligned_alloc(alignment, (size + alignment - 1) & ~(alignment - 1));
+}
+
+/**
+ * @brief Compile-time specialized arena, large enough for the biggest allocate case
+ */
+static alloc::StaticLinearAllocator<kOps * (4096 + 64), 64> g_static_arena;
+
+/**
+ * @brief allocate_bytes of the static arena, whose alignment is a template argument
+ */
+template <size_t Align>
+double bench_static_allocate(size_t size) {
+    return bench::best_ns_per_op(kRepetitions, kOps, [&] {
+        g_static_arena.reset();
+        for (size_t i = 0; i < kOps; i++) {
+            bench::do_not_optimize(g_static_arena.allocate_bytes<Align>(size));
+        }
+    });
+}
+
+/**
+ * @brief allocate_bytes throughput across sizes and alignments
+ *
+ * Every backend allocates kOps blocks and then frees them all: the arena by
+ * resetting, malloc and the pool resource block by block, the monotonic resource
+ * by being released.
+ */
+void bench_allocate(bench::JsonReport& report) {
+    std::vector<void*> pointers(kOps);
+
+    for (size_t size : {16, 64, 256, 1024, 4096}) {
+        for (size_t alignment : {8, 64}) {
+            std::string name = fmt::format("allocate/size:{}/align:{}", size, alignment);
+            size_t bytes = kOps * (size + alignment);
+
+            auto arena = alloc::LinearAllocator::create(bytes, false).value();
+            report.add(name, "arena", bench::best_ns_per_op(kRepetitions, kOps, [&] {
+                arena.reset();
+                for (size_t i = 0; i < kOps; i++) {
+                    bench::do_not_optimize(arena.allocate_bytes(size, alignment));
+                }
+            }));
+
+            report.add(name, "static_arena", alignment == 8 ? bench_static_allocate<8>(size)
+                                                            : bench_static_allocate<64>(size));
+
+            report.add(name, "malloc", bench::best_ns_per_op(kRepetitions, kOps, [&] {
+                for (size_t i = 0; i < kOps; i++) {
+                    pointers[i] = aligned_malloc(size, alignment);
+                    bench::do_not_optimize(pointers[i]);
+                }
+                for (size_t i = 0; i < kOps; i++) {
+                    std::free(pointers[i]);
+                }
+            }));
+
+            report.add(name, "pmr_monotonic", bench::best_ns_per_op(kRepetitions, kOps, [&] {
+                std::pmr::monotonic_buffer_resource resource(arena.buffer, bytes,
+                                                             std::pmr::null_memory_resource());
+                for (size_t i = 0; i < kOps; i++) {
+                    bench::do_not_optimize(resource.allocate(size, alignment));
+                }
+            }));
+
+            std::pmr::unsynchronized_pool_resource pool;
+            report.add(name, "pmr_pool", bench::best_ns_per_op(kRepetitions, kOps, [&] {
+                for (size_t i = 0; i < kOps; i++) {
+                    pointers[i] = pool.allocate(size, alignment);
+                    bench::do_not_optimize(pointers[i]);
+                }
+                for (size_t i = 0; i < kOps; i++) {
+                    pool.deallocate(pointers[i], size, alignment);
+                }
+            }));
+
+            std::free(arena.buffer);
+        }
+    }
+}
+
+/**
+ * @brief Cost of handing out zeroed memory
+ *
+ * After the first repetition the arena memory is dirty, so `zero_on_alloc` pays
+ * for a memset on every allocation; the non-zeroing arena is the baseline.
+ */
+void bench_zeroing(bench::JsonReport& report) {
+    std::vector<void*> pointers(kOps);
+
+    for (size_t size : {64, 4096}) {
+        std::string name = fmt::format("zeroed_allocate/size:{}", size);
+        size_t bytes = kOps * size;
+
+        auto zeroing = alloc::LinearAllocator::create(bytes, true).value();
+        report.add(name, "arena", bench::best_ns_per_op(kRepetitions, kOps, [&] {
+            zeroing.reset();
+            for (size_t i = 0; i < kOps; i++) {
+                auto result = zeroing.allocate_bytes(size, 16);
+                std::memset(result.value(), 0xAB, 8); // Dirty the block for the next repetition
+            }
+        }));
+
+        auto plain = alloc::LinearAllocator::create(bytes, false).value();
+        report.add(name, "arena_no_zero", bench::best_ns_per_op(kRepetitions, kOps, [&] {
+            plain.reset();
+            for (size_t i = 0; i < kOps; i++) {
+                auto result = plain.allocate_bytes(size, 16);
+                std::memset(result.value(), 0xAB, 8);
+            }
+        }));
+
+        report.add(name, "calloc", bench::best_ns_per_op(kRepetitions, kOps, [&] {
+            for (size_t i = 0; i < kOps; i++) {
+                pointers[i] = std::calloc(1, size);
+                std::memset(pointers[i], 0xAB, 8);
+            }
+            for (size_t i = 0; i < kOps; i++) {
+                std::free(pointers[i]);
+            }
+        }));
+
+        report.add(name, "pmr_monotonic", bench::best_ns_per_op(kRepetitions, kOps, [&] {
+            std::pmr::monotonic_buffer_resource resource(plain.buffer, bytes,
+                                                         std::pmr::null_memory_resource());
+            for (size_t i = 0; i < kOps; i++) {
+                void* ptr = resource.allocate(size, 16);
+                std::memset(ptr, 0, size);
+                std::memset(ptr, 0xAB, 8);
+            }
+        }));
+
+        std::pmr::unsynchronized_pool_resource pool;
+        report.add(name, "pmr_pool", bench::best_ns_per_op(kRepetitions, kOps, [&] {
+            for (size_t i = 0; i < kOps; i++) {
+                pointers[i] = pool.allocate(size, 16);
+                std::memset(pointers[i], 0, size);
+                std::memset(pointers[i], 0xAB, 8);
+            }
+            for (size_t i = 0; i < kOps; i++) {
+                pool.deallocate(pointers[i], size, 16);
+            }
+        }));
+
+        std::free(zeroing.buffer);
+        std::free(plain.buffer);
+    }
+}
+
+/**
+ * @brief Many small mixed-size nodes, one allocate_bytes call each versus one batch
+ *
+ * One operation is one node; the arena zeroes dirty memory in both variants.
+ */
+void bench_batch(bench::JsonReport& report) {
+    constexpr size_t kNodes = 64;
+    alloc::AllocRequest requests[kNodes];
+    for (size_t i = 0; i < kNodes; i++) {
+        requests[i] = alloc::AllocRequest{8 + (i % 4) * 8, i % 3 == 0 ? 16u : 8u};
+    }
+    void* pointers[kNodes];
+
+    auto arena = alloc::LinearAllocator::create(kOps * 64, true).value();
+    report.add("batch/nodes:64", "arena_single", bench::best_ns_per_op(kRepetitions, kOps, [&] {
+        arena.reset();
+        for (size_t batch = 0; batch < kOps / kNodes; batch++) {
+            for (size_t i = 0; i < kNodes; i++) {
+                bench::do_not_optimize(arena.allocate_bytes(requests[i].size, requests[i].alignment));
+            }
+        }
+    }));
+
+    report.add("batch/nodes:64", "arena_batch", bench::best_ns_per_op(kRepetitions, kOps, [&] {
+        arena.reset();
+        for (size_t batch = 0; batch < kOps / kNodes; batch++) {
+            bench::do_not_optimize(arena.allocate_batch(requests, pointers));
+            bench::do_not_optimize(pointers[kNodes - 1]);
+        }
+    }));
+
+    std::free(arena.buffer);
+}
+
+/**
+ * @brief Growing a buffer 16 bytes at a time
+ *
+ * "in_place" keeps the buffer the last allocation; "copying" makes a small
+ * allocation between resizes so every resize takes the copying branch.
+ */
+void bench_resize(bench::JsonReport& report) {
+    constexpr size_t kStep = 16;
+    constexpr size_t kSteps = 128;
+    constexpr size_t kChains = kOps / kSteps;
+
+    auto arena = alloc::LinearAllocator::create(size_t(8) * 1024 * 1024, false).value();
+
+    report.add("resize/in_place", "arena", bench::best_ns_per_op(kRepetitions, kOps, [&] {
+        arena.reset();
+        for (size_t chain = 0; chain < kChains; chain++) {
+            uint8_t* data = arena.allocate<uint8_t>(kStep).value();
+            for (size_t step = 1; step < kSteps; step++) {
+                data = arena.resize(data, step * kStep, (step + 1) * kStep).value();
+            }
+            bench::do_not_optimize(data);
+        }
+    }));
+
+    report.add("resize/copying", "arena", bench::best_ns_per_op(kRepetitions, kOps, [&] {
+        arena.reset();
+        for (size_t chain = 0; chain < kChains; chain++) {
+            uint8_t* data = arena.allocate<uint8_t>(kStep).value();
+            for (size_t step = 1; step < kSteps; step++) {
+                bench::do_not_optimize(arena.allocate_bytes(8, 8));
+                data = arena.resize(data, step * kStep, (step + 1) * kStep).value();
+            }
+            bench::do_not_optimize(data);
+        }
+    }));
+
+    report.add("resize", "realloc", bench::best_ns_per_op(kRepetitions, kOps, [&] {
+        for (size_t chain = 0; chain < kChains; chain++) {
+            void* data = std::malloc(kStep);
+            for (size_t step = 1; step < kSteps; step++) {
+                data = std::realloc(data, (step + 1) * kStep);
+            }
+            bench::do_not_optimize(data);
+            std::free(data);
+        }
+    }));
+
+    report.add("resize", "pmr_monotonic", bench::best_ns_per_op(kRepetitions, kOps, [&] {
+        std::pmr::monotonic_buffer_resource resource(arena.buffer, arena.capacity,
+                                                     std::pmr::null_memory_resource());
+        for (size_t chain = 0; chain < kChains; chain++) {
+            void* data = resource.allocate(kStep, 16);
+            for (size_t step = 1; step < kSteps; step++) {
+                void* grown = resource.allocate((step + 1) * kStep, 16);
+                std::memcpy(grown, data, step * kStep);
+                data = grown;
+            }
+            bench::do_not_optimize(data);
+        }
+    }));
+
+    std::pmr::unsynchronized_pool_resource pool;
+    report.add("resize", "pmr_pool", bench::best_ns_per_op(kRepetitions, kOps, [&] {
+        for (size_t chain = 0; chain < kChains; chain++) {
+            void* data = pool.allocate(kStep, 16);
+            for (size_t step = 1; step < kSteps; step++) {
+                void* grown = pool.allocate((step + 1) * kStep, 16);
+                std::memcpy(grown, data, step * kStep);
+                pool.deallocate(data, step * kStep, 16);
+                data = grown;
+            }
+            bench::do_not_optimize(data);
+            pool.deallocate(data, kSteps * kStep, 16);
+        }
+    }));
+
+    std::free(arena.buffer);
+}
+
+/**
+ * @brief Short-lived scopes making a few small allocations each
+ *
+ * One operation is one scope with 8 allocations of 32 bytes.
+ */
+void bench_scopes(bench::JsonReport& report) {
+    constexpr size_t kPerScope = 8;
+    constexpr size_t kSize = 32;
+    void* pointers[kPerScope];
+
+    auto arena = alloc::LinearAllocator::create(64 * 1024, false).value();
+    report.add("scope_churn", "arena", bench::best_ns_per_op(kRepetitions, kOps, [&] {
+        for (size_t scope = 0; scope < kOps; scope++) {
+            auto temp = alloc::TempArenaMemory::begin(arena);
+            for (size_t i = 0; i < kPerScope; i++) {
+                bench::do_not_optimize(arena.allocate_bytes(kSize, 8));
+            }
+        }
+    }));
+
+    report.add("scope_churn", "malloc", bench::best_ns_per_op(kRepetitions, kOps, [&] {
+        for (size_t scope = 0; scope < kOps; scope++) {
+            for (size_t i = 0; i < kPerScope; i++) {
+                pointers[i] = std::malloc(kSize);
+                bench::do_not_optimize(pointers[i]);
+            }
+            for (size_t i = 0; i < kPerScope; i++) {
+                std::free(pointers[i]);
+            }
+        }
+    }));
+
+    report.add("scope_churn", "pmr_monotonic", bench::best_ns_per_op(kRepetitions, kOps, [&] {
+        for (size_t scope = 0; scope < kOps; scope++) {
+            std::pmr::monotonic_buffer_resource resource(arena.buffer, 1024,
+                                                         std::pmr::null_memory_resource());
+            for (size_t i = 0; i < kPerScope; i++) {
+                bench::do_not_optimize(resource.allocate(kSize, 8));
+            }
+        }
+    }));
+
+    std::pmr::unsynchronized_pool_resource pool;
+    report.add("scope_churn", "pmr_pool", bench::best_ns_per_op(kRepetitions, kOps, [&] {
+        for (size_t scope = 0; scope < kOps; scope++) {
+            for (size_t i = 0; i < kPerScope; i++) {
+                pointers[i] = pool.allocate(kSize, 8);
+                bench::do_not_optimize(pointers[i]);
+            }
+            for (size_t i = 0; i < kPerScope; i++) {
+                pool.deallocate(pointers[i], kSize, 8);
+            }
+        }
+    }));
+
+    std::free(arena.buffer);
+}
+
+/**
+ * @brief Request-scoped arenas: a fresh owning arena per request against recycled buffers
+ *
+ * One operation is one request with 8 allocations of 256 bytes from a 64KB arena.
+ */
+void bench_request_arenas(bench::JsonReport& report) {
+    constexpr size_t kArenaSize = 64 * 1024;
+    constexpr size_t kPerRequest = 8;
+    constexpr size_t kSize = 256;
+    constexpr size_t kRequests = kOps / 4;
+
+    auto serve = [&](alloc::OwningArena arena) {
+        for (size_t i = 0; i < kPerRequest; i++) {
+            bench::do_not_optimize(arena.allocate_bytes(kSize, 8));
+        }
+    };
+
+    report.add("request_arena", "owning_malloc", bench::best_ns_per_op(kRepetitions, kRequests, [&] {
+        for (size_t request = 0; request < kRequests; request++) {
+            serve(alloc::OwningArena::create(kArenaSize, false).value());
+        }
+    }));
+
+    report.add("request_arena", "owning_mmap", bench::best_ns_per_op(kRepetitions, kRequests, [&] {
+        for (size_t request = 0; request < kRequests; request++) {
+            serve(alloc::OwningArena::create(kArenaSize, false, alloc::mmap_backing()).value());
+        }
+    }));
+
+    alloc::ArenaRecycler recycler(kArenaSize, 4, alloc::mmap_backing());
+    report.add("request_arena", "recycled_mmap", bench::best_ns_per_op(kRepetitions, kRequests, [&] {
+        for (size_t request = 0; request < kRequests; request++) {
+            serve(recycler.acquire(false).value());
+        }
+    }));
+}
+
+/**
+ * @brief One level of a call chain taking a temporary from the heap
+ */
+void chain_with_malloc(size_t depth, size_t size) {
+    if (depth == 0) {
+        return;
+    }
+    void* temp = std::malloc(size);
+    bench::do_not_optimize(temp);
+    chain_with_malloc(depth - 1, size);
+    std::free(temp);
+}
+
+/**
+ * @brief One level of a call chain taking a temporary from a scratch arena
+ */
+void chain_with_scratch(size_t depth, size_t size) {
+    if (depth == 0) {
+        return;
+    }
+    auto scratch = alloc::get_scratch().value();
+    void* temp = scratch.arena().allocate_bytes(size, 8).value();
+    bench::do_not_optimize(temp);
+    chain_with_scratch(depth - 1, size);
+}
+
+/**
+ * @brief Call chains needing temporaries at every level: heap against scratch arenas
+ *
+ * One operation is one chain of 8 nested calls, each taking a temporary of the
+ * case's size.
+ */
+void bench_scratch(bench::JsonReport& report) {
+    constexpr size_t kDepth = 8;
+
+    for (size_t size : {size_t(512), size_t(4096)}) {
+        std::string name = fmt::format("scratch_chain/size:{}", size);
+
+        report.add(name, "malloc", bench::best_ns_per_op(kRepetitions, kOps, [&] {
+            for (size_t op = 0; op < kOps; op++) {
+                chain_with_malloc(kDepth, size);
+            }
+        }));
+
+        report.add(name, "get_scratch", bench::best_ns_per_op(kRepetitions, kOps, [&] {
+            for (size_t op = 0; op < kOps; op++) {
+                chain_with_scratch(kDepth, size);
+            }
+        }));
+    }
+}
+
+/**
+ * @brief Run a body on several threads released together, return the best wall time
+ *
+ * @param thread_count Number of threads
+ * @param setup Callable run before each repetition, while no thread is running
+ * @param body Callable taking the thread index and running one repetition's work
+ * @return double Best nanoseconds per allocation over all threads
+ */
+template <typename Setup, typename Body>
+double run_threads(size_t thread_count, Setup&& setup, Body&& body) {
+    double best = 0.0;
+    for (int rep = 0; rep < kThreadRepetitions; rep++) {
+        setup();
+
+        std::atomic<bool> go{false};
+        std::atomic<size_t> ready{0};
+        std::vector<std::thread> threads;
+        threads.reserve(thread_count);
+
+        for (size_t t = 0; t < thread_count; t++) {
+            threads.emplace_back([&, t] {
+                ready.fetch_add(1);
+                while (!go.load(std::memory_order_acquire)) {
+                    std::this_thread::yield();
+                }
+                body(t);
+            });
+        }
+
+        while (ready.load() != thread_count) {
+            std::this_thread::yield();
+        }
+        bench::Timer timer = bench::Timer::begin();
+        go.store(true, std::memory_order_release);
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        double ns = timer.elapsed_ns() / static_cast<double>(thread_count * kThreadOps);
+        if (rep == 0 || ns < best) {
+            best = ns;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Allocate-in-batches-then-free pattern on 1 to N threads
+ *
+ * Reported times are wall time divided by the total number of allocations, so
+ * perfect scaling shows as a time that shrinks with the thread count.
+ */
+void bench_threads(bench::JsonReport& report) {
+    constexpr size_t kSize = 64;
+
+    size_t max_threads = std::max<size_t>(2, std::thread::hardware_concurrency());
+    std::vector<size_t> thread_counts{1};
+    for (size_t count = 2; count < max_threads; count *= 2) {
+        thread_counts.push_back(count);
+    }
+    thread_counts.push_back(max_threads);
+
+    for (size_t thread_count : thread_counts) {
+        std::vector<alloc::LinearAllocator> arenas;
+        for (size_t t = 0; t < thread_count; t++) {
+            arenas.push_back(alloc::LinearAllocator::create(kBatch * kSize, false).value());
+        }
+        report.add("threads/batch_alloc_free", "arena_per_thread", run_threads(thread_count, [] {}, [&](size_t t) {
+            for (size_t i = 0; i < kThreadOps; i++) {
+                if (i % kBatch == 0) {
+                    arenas[t].reset();
+                }
+                bench::do_not_optimize(arenas[t].allocate_bytes(kSize, 16));
+            }
+        }), thread_count);
+        for (auto& arena : arenas) {
+            std::free(arena.buffer);
+        }
+
+        auto shared = alloc::ConcurrentLinearAllocator::create(
+            thread_count * kThreadOps * kSize, false).value();
+        report.add("threads/batch_alloc_free", "arena_shared", run_threads(thread_count, [&] { shared.reset(); }, [&](size_t) {
+            for (size_t i = 0; i < kThreadOps; i++) {
+                bench::do_not_optimize(shared.allocate_bytes(kSize, 16));
+            }
+        }), thread_count);
+        std::free(shared.buffer);
+
+        auto pool = alloc::BlockPool::create(64 * 1024, static_cast<uint32_t>(thread_count * 4)).value();
+        report.add("threads/batch_alloc_free", "thread_arena", run_threads(thread_count, [] {}, [&](size_t) {
+            alloc::ThreadArena arena(pool, false);
+            for (size_t i = 0; i < kThreadOps; i++) {
+                if (i % kBatch == 0) {
+                    arena.reset();
+                }
+                bench::do_not_optimize(arena.allocate_bytes(kSize, 16));
+            }
+        }), thread_count);
+        pool.destroy();
+
+        report.add("threads/batch_alloc_free", "malloc", run_threads(thread_count, [] {}, [&](size_t) {
+            void* pointers[kBatch];
+            for (size_t i = 0; i < kThreadOps; i += kBatch) {
+                for (size_t j = 0; j < kBatch; j++) {
+                    pointers[j] = std::malloc(kSize);
+                    bench::do_not_optimize(pointers[j]);
+                }
+                for (size_t j = 0; j < kBatch; j++) {
+                    std::free(pointers[j]);
+                }
+            }
+        }), thread_count);
+
+        report.add("threads/batch_alloc_free", "pmr_monotonic", run_threads(thread_count, [] {}, [&](size_t) {
+            std::pmr::monotonic_buffer_resource resource(kBatch * kSize);
+            for (size_t i = 0; i < kThreadOps; i++) {
+                if (i % kBatch == 0) {
+                    resource.release();
+                }
+                bench::do_not_optimize(resource.allocate(kSize, 16));
+            }
+        }), thread_count);
+
+        report.add("threads/batch_alloc_free", "pmr_pool", run_threads(thread_count, [] {}, [&](size_t) {
+            std::pmr::unsynchronized_pool_resource resource;
+            void* pointers[kBatch];
+            for (size_t i = 0; i < kThreadOps; i += kBatch) {
+                for (size_t j = 0; j < kBatch; j++) {
+                    pointers[j] = resource.allocate(kSize, 16);
+                    bench::do_not_optimize(pointers[j]);
+                }
+                for (size_t j = 0; j < kBatch; j++) {
+                    resource.deallocate(pointers[j], kSize, 16);
+                }
+            }
+        }), thread_count);
+    }
+}
+
+int main(int argc, char** argv) {
+    const char* json_path = argc > 1 ? argv[1] : "allocator_suite.json";
+
+    fmt::print("Allocator Benchmark Suite\n");
+    fmt::print("=========================\n\n");
+    fmt::print("{:<40} {:<18} {:>3} {:>10}\n", "case", "backend", "thr", "ns/op");
+
+    bench::JsonReport report;
+    bench_allocate(report);
+    bench_zeroing(report);
+    bench_batch(report);
+    bench_resize(report);
+    bench_scopes(report);
+    bench_request_arenas(report);
+    bench_scratch(report);
+    bench_threads(report);
+
+    if (!report.write(json_path, "allocator_suite")) {
+        fmt::print("Failed to write {}\n", json_path);
+        return 1;
+    }
+    fmt::print("\nResults written to {}\n", json_path);
+    return 0;
+}
@@ -0,0 +1,124 @@
+// bench/bench_harness.hpp
+#pragma once
+
+#include <fmt/core.h>
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+/**
+ * @brief Keep the compiler from optimizing away a value computed by a benchmark
+ */
+template <typename T>
+inline void do_not_optimize(T const& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * @brief Keep the compiler from optimizing away or reordering writes to memory
+ */
+inline void clobber_memory() {
+    asm volatile("" : : : "memory");
+}
+
+/**
+ * @brief Monotonic wall clock timer
+ */
+struct Timer {
+    std::chrono::steady_clock::time_point start; ///< Time the timer was (re)started
+
+    /**
+     * @brief Create a running timer
+     */
+    static Timer begin() {
+        return Timer{std::chrono::steady_clock::now()};
+    }
+
+    /**
+     * @brief Nanoseconds elapsed since the timer was started
+     */
+    double elapsed_ns() const {
+        auto delta = std::chrono::steady_clock::now() - start;
+        return static_cast<double>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(delta).count());
+    }
+};
+
+/**
+ * @brief Run a benchmark body several times and return the best time per operation
+ *
+ * @param repetitions Number of timed repetitions, the fastest one is kept
+ * @param ops_per_run Number of operations performed by one call of the body
+ * @param body Callable running one repetition
+ * @return double Nanoseconds per operation of the fastest repetition
+ */
+template <typename Body>
+inline double best_ns_per_op(int repetitions, size_t ops_per_run, Body&& body) {
+    double best = 0.0;
+    for (int rep = 0; rep < repetitions; rep++) {
+        Timer timer = Timer::begin();
+        body();
+        double ns = timer.elapsed_ns() / static_cast<double>(ops_per_run);
+        if (rep == 0 || ns < best) {
+            best = ns;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief One measured result of a benchmark case for one allocator
+ */
+struct Result {
+    std::string name;    ///< Benchmark case, e.g. "allocate/size:64/align:16"
+    std::string backend; ///< Allocator measured, e.g. "arena" or "malloc"
+    double ns_per_op;    ///< Best time per operation in nanoseconds
+    size_t threads;      ///< Number of threads running the case
+};
+
+/**
+ * @brief Collects results and writes them as JSON, one entry per case and backend
+ */
+struct JsonReport {
+    std::vector<Result> results; ///< Results in the order they were recorded
+
+    /**
+     * @brief Record a result and print it as a table row
+     */
+    void add(std::string name, std::string backend, double ns_per_op, size_t threads = 1) {
+        fmt::print("{:<40} {:<18} {:>3} {:>10.2f}\n", name, backend, threads, ns_per_op);
+        results.push_back(Result{std::move(name), std::move(backend), ns_per_op, threads});
+    }
+
+    /**
+     * @brief Write every result to a JSON file
+     *
+     * @param path Output file path
+     * @param suite Name of the suite, stored at the top level
+     * @return bool Whether the file could be written
+     */
+    bool write(const char* path, const char* suite) const {
+        std::FILE* file = std::fopen(path, "w");
+        if (!file) {
+            return false;
+        }
+
+        fmt::print(file, "{{\n  \"suite\": \"{}\",\n  \"unit\": \"ns/op\",\n  \"results\": [\n", suite);
+        for (size_t i = 0; i < results.size(); i++) {
+            const Result& result = results[i];
+            fmt::print(file,
+                       "    {{\"name\": \"{}\", \"backend\": \"{}\", \"threads\": {}, \"ns_per_op\": {:.3f}}}{}\n",
+                       result.name, result.backend, result.threads, result.ns_per_op,
+                       i + 1 < results.size() ? "," : "");
+        }
+        fmt::print(file, "  ]\n}}\n");
+        return std::fclose(file) == 0;
+    }
+};
+
+} // namespace bench
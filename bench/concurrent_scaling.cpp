@@ -0,0 +1,105 @@
+// bench/concurrent_scaling.cpp
+#include <fmt/core.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "bench_harness.hpp"
+#include "../src/LinearAllocator/ConcurrentLinearAllocator.hpp"
+
+/**
+ * @brief Allocations made by each thread in one repetition
+ */
+constexpr size_t kAllocsPerThread = 1 << 18;
+
+/**
+ * @brief Size of every allocation made by the benchmark
+ */
+constexpr size_t kAllocSize = 48;
+
+/**
+ * @brief Run one repetition with every thread allocating from the shared arena
+ *
+ * @param arena The shared arena, reset before the threads start
+ * @param thread_count Number of allocating threads
+ * @return double Elapsed nanoseconds from the start signal until every thread finished
+ */
+double run_shared(alloc::ConcurrentLinearAllocator& arena, size_t thread_count) {
+    arena.reset();
+
+    std::atomic<bool> go{false};
+    std::atomic<size_t> ready{0};
+    std::vector<std::thread> threads;
+    threads.reserve(thread_count);
+
+    for (size_t t = 0; t < thread_count; t++) {
+        threads.emplace_back([&] {
+            ready.fetch_add(1);
+            while (!go.load(std::memory_order_acquire)) {
+            }
+            for (size_t i = 0; i < kAllocsPerThread; i++) {
+                auto result = arena.allocate_bytes(kAllocSize, 16);
+                bench::do_not_optimize(result);
+            }
+        });
+    }
+
+    while (ready.load() != thread_count) {
+    }
+    bench::Timer timer = bench::Timer::begin();
+    go.store(true, std::memory_order_release);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return timer.elapsed_ns();
+}
+
+int main() {
+    fmt::print("Concurrent Linear Allocator Scaling Benchmark\n");
+    fmt::print("=============================================\n\n");
+
+    size_t max_threads = std::thread::hardware_concurrency();
+    if (max_threads == 0) {
+        max_threads = 1;
+    }
+
+    // Room for every allocation of the largest thread count, including alignment padding
+    size_t capacity = max_threads * kAllocsPerThread * (kAllocSize + 16);
+    auto arena_result = alloc::ConcurrentLinearAllocator::create(capacity, false);
+    if (!arena_result) {
+        fmt::print("Failed to create allocator: {}\n",
+                   static_cast<int>(arena_result.error()));
+        return 1;
+    }
+
+    auto& arena = arena_result.value();
+    fmt::print("{:>8} {:>14} {:>14} {:>10}\n", "threads", "M allocs/s", "ns/alloc", "speedup");
+
+    // Powers of two up to the number of hardware threads, plus that number itself
+    std::vector<size_t> thread_counts;
+    for (size_t threads = 1; threads < max_threads; threads *= 2) {
+        thread_counts.push_back(threads);
+    }
+    thread_counts.push_back(max_threads);
+
+    double single_thread_rate = 0.0;
+    for (size_t threads : thread_counts) {
+        double best = 0.0;
+        for (int rep = 0; rep < 5; rep++) {
+            double ns = run_shared(arena, threads);
+            if (rep == 0 || ns < best) {
+                best = ns;
+            }
+        }
+
+        double total_allocs = static_cast<double>(threads * kAllocsPerThread);
+        double rate = total_allocs / best * 1e3;
+        if (threads == 1) {
+            single_thread_rate = rate;
+        }
+        fmt::print("{:>8} {:>14.1f} {:>14.2f} {:>10.2f}\n",
+                   threads, rate, best / total_allocs, rate / single_thread_rate);
+    }
+
+    std::free(arena.buffer);
+    return 0;
+}
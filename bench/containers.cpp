@@ -0,0 +1,116 @@
+// bench/containers.cpp
+#include <fmt/core.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "bench_harness.hpp"
+#include "../src/LinearAllocator/ArenaContainers.hpp"
+
+/**
+ * @brief Number of elements pushed or inserted per repetition
+ */
+constexpr size_t kElements = 100000;
+
+/**
+ * @brief Number of timed repetitions, the fastest one is reported
+ */
+constexpr int kRepetitions = 20;
+
+/**
+ * @brief Print one comparison row
+ */
+void report(const char* name, double arena_ns, double std_ns) {
+    fmt::print("{:<28} {:>10.2f} {:>10.2f} {:>8.2f}x\n", name, arena_ns, std_ns, std_ns / arena_ns);
+}
+
+int main() {
+    fmt::print("Arena Containers Benchmark\n");
+    fmt::print("==========================\n\n");
+
+    auto allocator_result = alloc::LinearAllocator::create(64 * 1024 * 1024, false);
+    if (!allocator_result) {
+        fmt::print("Failed to create allocator: {}\n",
+                   static_cast<int>(allocator_result.error()));
+        return 1;
+    }
+
+    auto& arena = allocator_result.value();
+    fmt::print("{:<28} {:>10} {:>10} {:>9}\n", "ns/element", "arena", "std", "speedup");
+
+    // push_back without reserve
+    double vector_arena = bench::best_ns_per_op(kRepetitions, kElements, [&] {
+        arena.reset();
+        alloc::ArenaVector<int> values(arena);
+        for (size_t i = 0; i < kElements; i++) {
+            values.push_back(static_cast<int>(i));
+        }
+        bench::do_not_optimize(values.data);
+    });
+    double vector_std = bench::best_ns_per_op(kRepetitions, kElements, [&] {
+        std::vector<int> values;
+        for (size_t i = 0; i < kElements; i++) {
+            values.push_back(static_cast<int>(i));
+        }
+        bench::do_not_optimize(values.data());
+    });
+    report("vector push_back", vector_arena, vector_std);
+
+    double segmented_arena = bench::best_ns_per_op(kRepetitions, kElements, [&] {
+        arena.reset();
+        alloc::SegmentedVector<int> values(arena);
+        for (size_t i = 0; i < kElements; i++) {
+            values.push_back(static_cast<int>(i));
+        }
+        bench::do_not_optimize(values.segments[0]);
+    });
+    report("segmented vector push_back", segmented_arena, vector_std);
+
+    // String building from small pieces
+    double string_arena = bench::best_ns_per_op(kRepetitions, kElements, [&] {
+        arena.reset();
+        alloc::StringBuilder builder(arena);
+        for (size_t i = 0; i < kElements; i++) {
+            builder.append("ab");
+            builder.append_int(static_cast<long long>(i % 100));
+        }
+        bench::do_not_optimize(builder.chars.data);
+    });
+    double string_std = bench::best_ns_per_op(kRepetitions, kElements, [&] {
+        std::string builder;
+        for (size_t i = 0; i < kElements; i++) {
+            builder += "ab";
+            builder += std::to_string(i % 100);
+        }
+        bench::do_not_optimize(builder.data());
+    });
+    report("string append", string_arena, string_std);
+
+    // Hash map inserts followed by lookups
+    double map_arena = bench::best_ns_per_op(kRepetitions, kElements, [&] {
+        arena.reset();
+        alloc::FlatHashMap<uint64_t, uint64_t> map(arena);
+        for (uint64_t i = 0; i < kElements; i++) {
+            map.insert_or_assign(i * 7919, i);
+        }
+        uint64_t sum = 0;
+        for (uint64_t i = 0; i < kElements; i++) {
+            sum += *map.find(i * 7919);
+        }
+        bench::do_not_optimize(sum);
+    });
+    double map_std = bench::best_ns_per_op(kRepetitions, kElements, [&] {
+        std::unordered_map<uint64_t, uint64_t> map;
+        for (uint64_t i = 0; i < kElements; i++) {
+            map.insert_or_assign(i * 7919, i);
+        }
+        uint64_t sum = 0;
+        for (uint64_t i = 0; i < kElements; i++) {
+            sum += map.find(i * 7919)->second;
+        }
+        bench::do_not_optimize(sum);
+    });
+    report("hash map insert + find", map_arena, map_std);
+
+    std::free(arena.buffer);
+    return 0;
+}
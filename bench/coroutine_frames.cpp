@@ -0,0 +1,177 @@
+// bench/coroutine_frames.cpp
+#include <fmt/core.h>
+#include <array>
+#include <coroutine>
+#include <exception>
+#include <string>
+#include <utility>
+#include "bench_harness.hpp"
+#include "../src/LinearAllocator/ArenaCoroutine.hpp"
+
+/**
+ * @brief Requests per timed run
+ */
+constexpr size_t kRequests = 2000;
+
+/**
+ * @brief Timed repetitions of every case
+ */
+constexpr int kRepetitions = 50;
+
+/**
+ * @brief Children awaited by every non-leaf coroutine
+ */
+constexpr int kFanOut = 4;
+
+/**
+ * @brief Promise base that leaves frame allocation to the global heap
+ */
+struct HeapPromiseBase {};
+
+/**
+ * @brief Lazy task with symmetric transfer, frames allocated as `Base` decides
+ */
+template <typename Base>
+struct Task {
+    struct promise_type : Base {
+        int value = 0;
+        std::coroutine_handle<> continuation;
+
+        Task get_return_object() {
+            return Task{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+
+        struct FinalAwaiter {
+            bool await_ready() noexcept { return false; }
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> self) noexcept {
+                auto next = self.promise().continuation;
+                return next ? next : std::noop_coroutine();
+            }
+            void await_resume() noexcept {}
+        };
+        FinalAwaiter final_suspend() noexcept { return {}; }
+
+        void return_value(int result) { value = result; }
+        void unhandled_exception() { std::terminate(); }
+    };
+
+    std::coroutine_handle<promise_type> handle;
+
+    explicit Task(std::coroutine_handle<promise_type> h) : handle(h) {}
+    Task(Task&& other) noexcept : handle(std::exchange(other.handle, nullptr)) {}
+    Task(const Task&) = delete;
+    ~Task() {
+        if (handle) {
+            handle.destroy();
+        }
+    }
+
+    bool await_ready() { return false; }
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> caller) {
+        handle.promise().continuation = caller;
+        return handle;
+    }
+    int await_resume() { return handle.promise().value; }
+
+    int run() {
+        handle.resume();
+        return handle.promise().value;
+    }
+};
+
+template <typename Base>
+Task<Base> leaf(alloc::LinearAllocator& arena, int value) {
+    (void)arena;
+    co_return value * 2;
+}
+
+/**
+ * @brief Awaits its children one after the other, each frame is gone before the next starts
+ */
+template <typename Base>
+Task<Base> sequential(alloc::LinearAllocator& arena, int value, int depth) {
+    int sum = 0;
+    for (int i = 0; i < kFanOut; i++) {
+        if (depth > 1) {
+            sum += co_await sequential<Base>(arena, value + i, depth - 1);
+        } else {
+            sum += co_await leaf<Base>(arena, value + i);
+        }
+    }
+    co_return sum;
+}
+
+/**
+ * @brief Creates all its children before awaiting any, so their frames are alive together
+ */
+template <typename Base>
+Task<Base> fan_out(alloc::LinearAllocator& arena, int value, int depth) {
+    std::array<Task<Base>, kFanOut> children{
+        depth > 1 ? fan_out<Base>(arena, value, depth - 1) : leaf<Base>(arena, value),
+        depth > 1 ? fan_out<Base>(arena, value + 1, depth - 1) : leaf<Base>(arena, value + 1),
+        depth > 1 ? fan_out<Base>(arena, value + 2, depth - 1) : leaf<Base>(arena, value + 2),
+        depth > 1 ? fan_out<Base>(arena, value + 3, depth - 1) : leaf<Base>(arena, value + 3)};
+    int sum = 0;
+    for (auto& child : children) {
+        sum += co_await child;
+    }
+    co_return sum;
+}
+
+/**
+ * @brief Time one request tree shape with frames from `Base`, the arena is reset per request
+ */
+template <typename Base, typename Root>
+double run_case(alloc::LinearAllocator& arena, Root root) {
+    int checksum = 0;
+    double ns = bench::best_ns_per_op(kRepetitions, kRequests, [&] {
+        for (size_t i = 0; i < kRequests; i++) {
+            arena.reset();
+            Task<Base> request = root(arena, static_cast<int>(i));
+            checksum += request.run();
+        }
+    });
+    bench::do_not_optimize(checksum);
+    return ns;
+}
+
+int main(int argc, char** argv) {
+    const char* json_path = argc > 1 ? argv[1] : "coroutine_frames.json";
+
+    fmt::print("Coroutine Frame Allocation Benchmark\n");
+    fmt::print("====================================\n\n");
+
+    auto arena = alloc::LinearAllocator::create(1024 * 1024, false).value();
+    bench::JsonReport report;
+    fmt::print("{:<40} {:<18} {:>3} {:>10}\n", "case (ns per request)", "backend", "thr", "value");
+
+    for (int depth : {2, 3}) {
+        std::string sequential_name = fmt::format("sequential/depth:{}", depth);
+        report.add(sequential_name, "heap_frames", run_case<HeapPromiseBase>(arena, [depth](auto& a, int v) {
+            return sequential<HeapPromiseBase>(a, v, depth);
+        }));
+        report.add(sequential_name, "arena_frames",
+                   run_case<alloc::ArenaPromiseBase>(arena, [depth](auto& a, int v) {
+                       return sequential<alloc::ArenaPromiseBase>(a, v, depth);
+                   }));
+
+        std::string fan_out_name = fmt::format("fan_out/depth:{}", depth);
+        report.add(fan_out_name, "heap_frames", run_case<HeapPromiseBase>(arena, [depth](auto& a, int v) {
+            return fan_out<HeapPromiseBase>(a, v, depth);
+        }));
+        report.add(fan_out_name, "arena_frames",
+                   run_case<alloc::ArenaPromiseBase>(arena, [depth](auto& a, int v) {
+                       return fan_out<alloc::ArenaPromiseBase>(a, v, depth);
+                   }));
+    }
+
+    std::free(arena.buffer);
+
+    if (!report.write(json_path, "coroutine_frames")) {
+        fmt::print("Failed to write {}\n", json_path);
+        return 1;
+    }
+    fmt::print("\nResults written to {}\n", json_path);
+    return 0;
+}
@@ -0,0 +1,178 @@
+// bench/placement_random_access.cpp
+#include <fmt/core.h>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include "bench_harness.hpp"
+#include "../src/LinearAllocator/ArenaPlacement.hpp"
+
+/**
+ * @brief One cache line of the pointer-chasing workload
+ */
+struct Node {
+    Node* next;            ///< Next node of the random cycle
+    uint8_t padding[56];   ///< Keep every node on its own cache line
+};
+
+/**
+ * @brief Hardware counter for data TLB read misses, if the kernel lets us open one
+ */
+struct TlbCounter {
+    int fd; ///< perf event file descriptor, or -1 when unavailable
+
+    /**
+     * @brief Open a dTLB read miss counter for this thread
+     */
+    static TlbCounter open() {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.type = PERF_TYPE_HW_CACHE;
+        attr.size = sizeof(attr);
+        attr.config = PERF_COUNT_HW_CACHE_DTLB |
+                      (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                      (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        int fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+        return TlbCounter{fd};
+    }
+
+    void start() {
+        if (fd >= 0) {
+            ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+
+    /**
+     * @brief Stop counting and return the number of misses, or -1 if unavailable
+     */
+    long long stop() {
+        if (fd < 0) {
+            return -1;
+        }
+        ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        long long count = 0;
+        if (read(fd, &count, sizeof(count)) != sizeof(count)) {
+            return -1;
+        }
+        return count;
+    }
+};
+
+/**
+ * @brief Link every node of the arena into a single random cycle (Sattolo's algorithm)
+ *
+ * @param nodes Nodes allocated from the arena
+ * @param count Number of nodes
+ */
+void build_cycle(Node* nodes, size_t count) {
+    size_t* order = static_cast<size_t*>(std::malloc(count * sizeof(size_t)));
+    for (size_t i = 0; i < count; i++) {
+        order[i] = i;
+    }
+
+    std::mt19937_64 rng(42);
+    for (size_t i = count - 1; i > 0; i--) {
+        size_t j = std::uniform_int_distribution<size_t>(0, i - 1)(rng);
+        size_t tmp = order[i];
+        order[i] = order[j];
+        order[j] = tmp;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        nodes[order[i]].next = &nodes[order[(i + 1) % count]];
+    }
+    std::free(order);
+}
+
+/**
+ * @brief Run the random-access workload over an arena placed with the given options
+ *
+ * @param name Label printed for the configuration
+ * @param bytes Arena size in bytes
+ * @param options Placement options for the arena
+ * @param steps Number of dependent loads to time
+ */
+void run_config(const char* name, size_t bytes, const alloc::PlacementOptions& options, size_t steps) {
+    auto arena_result = alloc::create_mapped_arena(bytes, options, false);
+    if (!arena_result) {
+        fmt::print("{:<12} failed to map arena\n", name);
+        return;
+    }
+
+    auto& arena = arena_result.value();
+    size_t count = bytes / sizeof(Node);
+    auto nodes_result = arena.allocate<Node>(count, 64);
+    if (!nodes_result) {
+        fmt::print("{:<12} failed to allocate nodes\n", name);
+        alloc::destroy_mapped_arena(arena);
+        return;
+    }
+
+    Node* nodes = nodes_result.value();
+    build_cycle(nodes, count);
+
+    // Warm up, then time a long chain of dependent loads
+    Node* current = nodes;
+    for (size_t i = 0; i < steps / 10; i++) {
+        current = current->next;
+    }
+
+    TlbCounter counter = TlbCounter::open();
+    counter.start();
+    bench::Timer timer = bench::Timer::begin();
+    for (size_t i = 0; i < steps; i++) {
+        current = current->next;
+    }
+    double ns = timer.elapsed_ns();
+    long long misses = counter.stop();
+    bench::do_not_optimize(current);
+    if (counter.fd >= 0) {
+        close(counter.fd);
+    }
+
+    if (misses >= 0) {
+        fmt::print("{:<12} {:>10.2f} {:>16.3f}\n", name, ns / static_cast<double>(steps),
+                   static_cast<double>(misses) / static_cast<double>(steps));
+    } else {
+        fmt::print("{:<12} {:>10.2f} {:>16}\n", name, ns / static_cast<double>(steps), "n/a");
+    }
+
+    alloc::destroy_mapped_arena(arena);
+}
+
+int main(int argc, char** argv) {
+    fmt::print("Arena Placement Random Access Benchmark\n");
+    fmt::print("=======================================\n\n");
+
+    // Usage: placement_random_access [arena MB] [NUMA node]
+    size_t megabytes = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 512;
+    int node = argc > 2 ? std::atoi(argv[2]) : -1;
+    size_t bytes = megabytes * 1024 * 1024;
+    size_t steps = size_t(20) * 1000 * 1000;
+
+    fmt::print("Arena: {} MB, huge page size: {} KB, NUMA node: {}\n\n",
+               megabytes, alloc::huge_page_size() / 1024, node);
+    fmt::print("{:<12} {:>10} {:>16}\n", "pages", "ns/access", "dTLB misses/acc");
+
+    alloc::PlacementOptions options;
+    options.numa_node = node;
+    options.prefault = true;
+
+    options.huge_pages = alloc::HugePages::Disabled;
+    run_config("4K pages", bytes, options, steps);
+
+    options.huge_pages = alloc::HugePages::Transparent;
+    run_config("THP", bytes, options, steps);
+
+    options.huge_pages = alloc::HugePages::Explicit;
+    run_config("hugetlb", bytes, options, steps);
+
+    return 0;
+}
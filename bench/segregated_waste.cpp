@@ -0,0 +1,178 @@
+// bench/segregated_waste.cpp
+#include <fmt/core.h>
+#include <string>
+#include <vector>
+#include "bench_harness.hpp"
+#include "../src/LinearAllocator/SegregatedArena.hpp"
+
+/**
+ * @brief Timed repetitions of every case
+ */
+constexpr int kRepetitions = 20;
+
+/**
+ * @brief Allocations in every trace
+ */
+constexpr size_t kTraceLength = 100000;
+
+/**
+ * @brief One request of an allocation trace
+ */
+struct TraceEntry {
+    uint32_t size;      ///< Requested bytes
+    uint32_t alignment; ///< Requested alignment
+};
+
+/**
+ * @brief Small deterministic generator, so every run replays the same traces
+ */
+struct XorShift {
+    uint64_t state;
+
+    uint32_t below(uint32_t bound) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return static_cast<uint32_t>(state % bound);
+    }
+};
+
+/**
+ * @brief Strings, small structs and cache-line aligned SIMD buffers, interleaved
+ */
+std::vector<TraceEntry> strings_and_simd() {
+    XorShift rng{0x9E3779B97F4A7C15ull};
+    std::vector<TraceEntry> trace;
+    for (size_t i = 0; i < kTraceLength; i++) {
+        switch (rng.below(3)) {
+        case 0: trace.push_back({1 + rng.below(32), 1}); break;
+        case 1: trace.push_back({rng.below(2) ? 24u : 40u, 8}); break;
+        default: trace.push_back({64 * (1 + rng.below(8)), 64}); break;
+        }
+    }
+    return trace;
+}
+
+/**
+ * @brief Parser-like trace: tokens, 8-byte aligned nodes and 16-byte aligned vectors
+ */
+std::vector<TraceEntry> parser_nodes() {
+    XorShift rng{0xD1B54A32D192ED03ull};
+    std::vector<TraceEntry> trace;
+    for (size_t i = 0; i < kTraceLength; i++) {
+        switch (rng.below(4)) {
+        case 0:
+        case 1: trace.push_back({1 + rng.below(16), 1}); break;
+        case 2: trace.push_back({16 + 8 * rng.below(5), 8}); break;
+        default: trace.push_back({32, 16}); break;
+        }
+    }
+    return trace;
+}
+
+/**
+ * @brief Only cache-line aligned buffers of whole cache lines, nothing to gain
+ */
+std::vector<TraceEntry> simd_only() {
+    XorShift rng{0x2545F4914F6CDD1Dull};
+    std::vector<TraceEntry> trace;
+    for (size_t i = 0; i < kTraceLength; i++) {
+        trace.push_back({64 * (1 + rng.below(8)), 64});
+    }
+    return trace;
+}
+
+/**
+ * @brief Replay a trace, return whether every request was served
+ */
+template <typename Arena>
+bool replay(Arena& arena, const std::vector<TraceEntry>& trace) {
+    for (const TraceEntry& entry : trace) {
+        auto result = arena.allocate_bytes(entry.size, entry.alignment);
+        if (!result) {
+            return false;
+        }
+        bench::do_not_optimize(result.value());
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    const char* json_path = argc > 1 ? argv[1] : "segregated_waste.json";
+
+    fmt::print("Segregated Arena Padding Benchmark\n");
+    fmt::print("==================================\n\n");
+
+    auto parent_result = alloc::LinearAllocator::create(size_t(64) * 1024 * 1024, false);
+    if (!parent_result) {
+        fmt::print("Failed to create allocator\n");
+        return 1;
+    }
+    auto& parent = parent_result.value();
+
+    struct NamedTrace {
+        const char* name;
+        std::vector<TraceEntry> entries;
+    };
+    NamedTrace traces[] = {{"strings_and_simd", strings_and_simd()},
+                           {"parser_nodes", parser_nodes()},
+                           {"simd_only", simd_only()}};
+
+    // Footprint first: waste is everything used beyond the requested bytes
+    fmt::print("{:<20} {:>12} {:>12} {:>8} {:>12} {:>8}\n", "trace", "requested", "one arena",
+               "waste", "segregated", "waste");
+    for (const NamedTrace& trace : traces) {
+        size_t requested = 0;
+        for (const TraceEntry& entry : trace.entries) {
+            requested += entry.size;
+        }
+
+        parent.reset();
+        if (!replay(parent, trace.entries)) {
+            fmt::print("Failed to replay {}\n", trace.name);
+            return 1;
+        }
+        size_t plain = parent.used;
+        parent.reset();
+
+        alloc::SegregatedArena segregated(parent);
+        if (!replay(segregated, trace.entries)) {
+            fmt::print("Failed to replay {}\n", trace.name);
+            return 1;
+        }
+        size_t bucketed = segregated.footprint();
+        segregated.reset();
+
+        fmt::print("{:<20} {:>12} {:>12} {:>7.2f}% {:>12} {:>7.2f}%\n", trace.name, requested, plain,
+                   100.0 * static_cast<double>(plain - requested) / static_cast<double>(plain),
+                   bucketed,
+                   100.0 * static_cast<double>(bucketed - requested) / static_cast<double>(bucketed));
+    }
+
+    bench::JsonReport report;
+    fmt::print("\n{:<40} {:<18} {:>3} {:>10}\n", "case (ns per allocation)", "backend", "thr", "value");
+    for (const NamedTrace& trace : traces) {
+        std::string name = fmt::format("trace:{}", trace.name);
+
+        report.add(name, "arena", bench::best_ns_per_op(kRepetitions, trace.entries.size(), [&] {
+            parent.reset();
+            replay(parent, trace.entries);
+        }));
+
+        alloc::SegregatedArena segregated(parent);
+        report.add(name, "segregated", bench::best_ns_per_op(kRepetitions, trace.entries.size(), [&] {
+            segregated.reset();
+            replay(segregated, trace.entries);
+        }));
+        segregated.reset();
+    }
+
+    std::free(parent.buffer);
+
+    if (!report.write(json_path, "segregated_waste")) {
+        fmt::print("Failed to write {}\n", json_path);
+        return 1;
+    }
+    fmt::print("\nResults written to {}\n", json_path);
+    return 0;
+}
@@ -0,0 +1,183 @@
+// bench/shared_arena.cpp
+#include <fmt/core.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "bench_harness.hpp"
+#include "../src/LinearAllocator/SharedArena.hpp"
+
+/**
+ * @brief Size of one shared arena generation
+ */
+constexpr size_t kGenerationBytes = size_t(16) * 1024 * 1024;
+
+/**
+ * @brief Timed repetitions of every case
+ */
+constexpr int kRepetitions = 3;
+
+/**
+ * @brief Write or read exactly `size` bytes, pipes may transfer less per call
+ */
+bool write_all(int fd, const void* data, size_t size) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    while (size > 0) {
+        ssize_t written = write(fd, bytes, size);
+        if (written <= 0) {
+            return false;
+        }
+        bytes += written;
+        size -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+bool read_all(int fd, void* data, size_t size) {
+    uint8_t* bytes = static_cast<uint8_t*>(data);
+    while (size > 0) {
+        ssize_t got = read(fd, bytes, size);
+        if (got <= 0) {
+            return false;
+        }
+        bytes += got;
+        size -= static_cast<size_t>(got);
+    }
+    return true;
+}
+
+/**
+ * @brief What the consumer does with every message: read all of it
+ */
+uint64_t consume(const uint8_t* message, size_t size) {
+    const uint64_t* words = reinterpret_cast<const uint64_t*>(message);
+    uint64_t sum = 0;
+    for (size_t i = 0; i < size / sizeof(uint64_t); i++) {
+        sum += words[i];
+    }
+    return sum;
+}
+
+/**
+ * @brief Build `messages` messages of `size` bytes in a child-visible form and time the round trips
+ *
+ * The producer builds each message, hands it over and waits for the consumer to
+ * acknowledge it after reading every byte.
+ *
+ * @param shared Pass a SharedRef through the pipe (true) or the whole message (false)
+ * @return double Best nanoseconds per message, or a negative value on failure
+ */
+double run_case(bool shared, size_t size, size_t messages) {
+    auto arena_result = alloc::SharedArena::create(kGenerationBytes, false);
+    if (!arena_result) {
+        return -1.0;
+    }
+    auto& arena = arena_result.value();
+
+    int to_child[2];
+    int to_parent[2];
+    if (pipe(to_child) != 0 || pipe(to_parent) != 0) {
+        arena.destroy();
+        return -1.0;
+    }
+
+    std::fflush(stdout);
+    pid_t child = fork();
+    if (child == 0) {
+        close(to_child[1]);
+        close(to_parent[0]);
+        size_t slot = arena.register_reader().value();
+        uint8_t* copy = static_cast<uint8_t*>(std::malloc(size));
+        uint64_t ack = 0;
+        alloc::SharedRef ref;
+
+        for (size_t i = 0; i < messages * kRepetitions; i++) {
+            if (shared) {
+                if (!read_all(to_child[0], &ref, sizeof(ref))) {
+                    break;
+                }
+                const uint8_t* message = arena.pin(slot, ref).value();
+                ack += consume(message, ref.size);
+                arena.unpin(slot);
+            } else {
+                if (!read_all(to_child[0], copy, size)) {
+                    break;
+                }
+                ack += consume(copy, size);
+            }
+            write_all(to_parent[1], &ack, sizeof(ack));
+        }
+        std::free(copy);
+        _exit(0);
+    }
+    close(to_child[0]);
+    close(to_parent[1]);
+
+    uint8_t* local = static_cast<uint8_t*>(std::malloc(size));
+    uint64_t ack = 0;
+    double ns = bench::best_ns_per_op(kRepetitions, messages, [&] {
+        for (size_t i = 0; i < messages; i++) {
+            uint8_t* message = local;
+            if (shared) {
+                auto allocated = arena.allocate<uint8_t>(size, 64);
+                if (!allocated) {
+                    arena.reset();
+                    allocated = arena.allocate<uint8_t>(size, 64);
+                }
+                message = allocated.value();
+            }
+
+            // Build the message where it will be read from
+            std::memset(message, static_cast<int>(i), size);
+
+            if (shared) {
+                alloc::SharedRef ref = arena.ref(message, size);
+                write_all(to_child[1], &ref, sizeof(ref));
+            } else {
+                write_all(to_child[1], message, size);
+            }
+            read_all(to_parent[0], &ack, sizeof(ack));
+        }
+    });
+    bench::do_not_optimize(ack);
+
+    close(to_child[1]);
+    close(to_parent[0]);
+    waitpid(child, nullptr, 0);
+    std::free(local);
+    arena.destroy();
+    return ns;
+}
+
+int main(int argc, char** argv) {
+    const char* json_path = argc > 1 ? argv[1] : "shared_arena.json";
+
+    fmt::print("Shared Arena Benchmark\n");
+    fmt::print("======================\n\n");
+
+    bench::JsonReport report;
+    fmt::print("{:<40} {:<18} {:>3} {:>10}\n", "case (ns per message round trip)", "backend", "thr", "value");
+
+    const size_t sizes[] = {4 * 1024, 64 * 1024, 1024 * 1024};
+    for (size_t size : sizes) {
+        size_t messages = size >= 1024 * 1024 ? 200 : 2000;
+        std::string name = fmt::format("message/size:{}", size);
+
+        double pipe_ns = run_case(false, size, messages);
+        double shared_ns = run_case(true, size, messages);
+        if (pipe_ns < 0.0 || shared_ns < 0.0) {
+            fmt::print("Failed to run case {}\n", name);
+            return 1;
+        }
+        report.add(name, "pipe_copy", pipe_ns, 2);
+        report.add(name, "shared_arena", shared_ns, 2);
+    }
+
+    if (!report.write(json_path, "shared_arena")) {
+        fmt::print("Failed to write {}\n", json_path);
+        return 1;
+    }
+    fmt::print("\nResults written to {}\n", json_path);
+    return 0;
+}
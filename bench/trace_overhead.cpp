@@ -0,0 +1,58 @@
+// bench/trace_overhead.cpp
+#include <fmt/core.h>
+#include <string>
+#include "bench_harness.hpp"
+#include "../src/LinearAllocator/LinearAllocator.hpp"
+
+#ifndef LINEAR_ALLOCATOR_TRACE
+#error "trace_overhead must be built with LINEAR_ALLOCATOR_TRACE"
+#endif
+
+/**
+ * @brief Allocations per timed run
+ */
+constexpr size_t kOps = 4096;
+
+/**
+ * @brief Timed repetitions of every case
+ */
+constexpr int kRepetitions = 200;
+
+int main(int argc, char** argv) {
+    const char* json_path = argc > 1 ? argv[1] : "trace_overhead.json";
+    std::string trace_path = std::string(json_path) + ".trace";
+
+    fmt::print("Trace Recorder Overhead Benchmark\n");
+    fmt::print("=================================\n\n");
+
+    auto arena = alloc::LinearAllocator::create(kOps * 128, false).value();
+    bench::JsonReport report;
+    fmt::print("{:<40} {:<18} {:>3} {:>10}\n", "case (ns per allocation)", "backend", "thr", "value");
+
+    auto run = [&] {
+        arena.reset();
+        for (size_t i = 0; i < kOps; i++) {
+            bench::do_not_optimize(arena.allocate_bytes(64, 16));
+        }
+    };
+
+    // Hooks compiled in but no trace open: one relaxed load per event
+    report.add("allocate/size:64", "trace_idle", bench::best_ns_per_op(kRepetitions, kOps, run));
+
+    if (!alloc::trace_start(trace_path.c_str())) {
+        fmt::print("Failed to open {}\n", trace_path);
+        return 1;
+    }
+    report.add("allocate/size:64", "trace_recording", bench::best_ns_per_op(kRepetitions, kOps, run));
+    alloc::trace_stop();
+    std::remove(trace_path.c_str());
+
+    std::free(arena.buffer);
+
+    if (!report.write(json_path, "trace_overhead")) {
+        fmt::print("Failed to write {}\n", json_path);
+        return 1;
+    }
+    fmt::print("\nResults written to {}\n", json_path);
+    return 0;
+}
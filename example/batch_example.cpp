@@ -0,0 +1,89 @@
+// example/batch_example.cpp
+#include <fmt/core.h>
+#include <cstdint>
+#include "../src/LinearAllocator/LinearAllocator.hpp"
+
+/**
+ * @brief A parsed syntax tree node
+ */
+struct Node {
+    uint32_t kind;
+    uint32_t child_count;
+    Node* first_child;
+};
+
+int main() {
+    fmt::print("Batch Allocation Example\n");
+    fmt::print("========================\n\n");
+
+    auto allocator_result = alloc::LinearAllocator::create(64 * 1024);
+    if (!allocator_result) {
+        fmt::print("Failed to create allocator: {}\n",
+                   static_cast<int>(allocator_result.error()));
+        return 1;
+    }
+
+    auto& allocator = allocator_result.value();
+    bool ok = true;
+
+    // A message header, its nodes and a cache-line aligned payload in one bump
+    alloc::AllocRequest requests[] = {
+        {16, 8},
+        {sizeof(Node) * 32, alignof(Node)},
+        {3, 1},
+        {256, 64},
+    };
+    void* pointers[std::size(requests)];
+
+    auto batch = allocator.allocate_batch(requests, pointers);
+    if (!batch) {
+        fmt::print("Batch allocation failed\n");
+        return 1;
+    }
+
+    for (size_t i = 0; i < std::size(requests); i++) {
+        uintptr_t address = reinterpret_cast<uintptr_t>(pointers[i]);
+        bool aligned = address % requests[i].alignment == 0;
+        fmt::print("Request {}: {:>4} bytes, align {:>2}, offset {:>4}, aligned: {}\n", i,
+                   requests[i].size, requests[i].alignment,
+                   static_cast<uint8_t*>(pointers[i]) - allocator.buffer, aligned);
+        ok = ok && aligned;
+    }
+    fmt::print("Arena used after the batch: {} bytes\n", allocator.used);
+
+    // The last request can still be resized in place
+    auto payload = allocator.resize(static_cast<uint8_t*>(pointers[3]), 256, 512);
+    ok = ok && payload && payload.value() == pointers[3];
+    fmt::print("Last block grown in place: {}\n", payload && payload.value() == pointers[3]);
+
+    // Struct-of-arrays layout for particles
+    constexpr size_t kParticles = 1000;
+    auto soa = allocator.allocate_soa<float, float, uint16_t>(kParticles);
+    if (!soa) {
+        fmt::print("SoA allocation failed\n");
+        return 1;
+    }
+    auto [xs, ys, ids] = soa.value();
+    for (size_t i = 0; i < kParticles; i++) {
+        xs[i] = static_cast<float>(i);
+        ys[i] = 0.0f;
+        ids[i] = static_cast<uint16_t>(i);
+    }
+    fmt::print("\nSoA arrays at offsets {}, {}, {}\n",
+               reinterpret_cast<uint8_t*>(xs) - allocator.buffer,
+               reinterpret_cast<uint8_t*>(ys) - allocator.buffer,
+               reinterpret_cast<uint8_t*>(ids) - allocator.buffer);
+    ok = ok && reinterpret_cast<uint8_t*>(ys) >= reinterpret_cast<uint8_t*>(xs + kParticles);
+
+    // A batch that does not fit allocates nothing
+    size_t used_before = allocator.used;
+    alloc::AllocRequest huge[] = {{64, 8}, {1024 * 1024, 8}};
+    void* huge_pointers[2];
+    auto failed = allocator.allocate_batch(huge, huge_pointers);
+    fmt::print("Oversized batch failed: {}, used unchanged: {}\n",
+               !failed, allocator.used == used_before);
+    ok = ok && !failed && allocator.used == used_before;
+
+    std::free(allocator.buffer);
+    return ok ? 0 : 1;
+}
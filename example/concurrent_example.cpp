@@ -0,0 +1,169 @@
+// example/concurrent_example.cpp
+#include <fmt/core.h>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <functional>
+#include <thread>
+#include <vector>
+#include "../src/LinearAllocator/ConcurrentLinearAllocator.hpp"
+
+/**
+ * @brief A block handed out to one of the worker threads
+ */
+struct Claim {
+    uint8_t* ptr;     ///< Start of the block
+    size_t size;      ///< Size of the block in bytes
+    size_t alignment; ///< Alignment that was requested
+    uint8_t tag;      ///< Byte pattern the owning thread filled the block with
+};
+
+/**
+ * @brief Worker that hammers the shared allocator and fills every block it gets
+ *
+ * Every eighth block is grown with resize right after it was allocated, which is
+ * in place only if no other thread allocated in between.
+ *
+ * @param arena The shared allocator
+ * @param thread_index Index of the worker, used as fill pattern
+ * @param iterations Number of allocations to make
+ * @param claims Output list of blocks owned by this worker
+ */
+void worker(alloc::ConcurrentLinearAllocator& arena, size_t thread_index,
+            size_t iterations, std::vector<Claim>& claims) {
+    uint8_t tag = static_cast<uint8_t>(thread_index + 1);
+    uint32_t state = static_cast<uint32_t>(thread_index * 2654435761u + 1);
+
+    for (size_t i = 0; i < iterations; i++) {
+        state = state * 1664525u + 1013904223u;
+        size_t size = 1 + (state >> 8) % 200;
+        size_t alignment = size_t(1) << ((state >> 24) % 7);
+
+        auto result = arena.allocate<uint8_t>(size, alignment);
+        if (!result) {
+            return; // Out of memory ends the run for this thread
+        }
+        uint8_t* ptr = result.value();
+
+        if (i % 8 == 0) {
+            auto grown = arena.resize<uint8_t>(ptr, size, size * 2, alignment);
+            if (grown) {
+                ptr = grown.value();
+                size *= 2;
+            }
+        }
+
+        std::fill(ptr, ptr + size, tag);
+        claims.push_back(Claim{ptr, size, alignment, tag});
+    }
+}
+
+/**
+ * @brief Shrink blocks in one thread while another allocates from a zeroing arena
+ *
+ * The shrinking thread dirties every block before handing its tail back, so a
+ * tail that is not cleared before it is released shows up as non-zero memory
+ * in the allocating thread.
+ *
+ * @param iterations Number of allocate/shrink rounds
+ * @return size_t Number of fresh allocations that did not read as zero
+ */
+size_t shrink_while_allocating(size_t iterations) {
+    auto arena_result = alloc::ConcurrentLinearAllocator::create(iterations * (4096 + 256 + 64), true);
+    if (!arena_result) {
+        return 1;
+    }
+    auto& arena = arena_result.value();
+
+    std::atomic<bool> start{false};
+    std::thread shrinker([&] {
+        while (!start.load()) {
+        }
+        for (size_t i = 0; i < iterations; i++) {
+            auto result = arena.allocate<uint8_t>(4096);
+            if (!result) {
+                break;
+            }
+            std::memset(result.value(), 0xAB, 4096);
+            (void)arena.resize<uint8_t>(result.value(), 4096, 1);
+        }
+    });
+
+    size_t dirty = 0;
+    start.store(true);
+    for (size_t i = 0; i < iterations; i++) {
+        auto result = arena.allocate<uint8_t>(256);
+        if (!result) {
+            break;
+        }
+        uint8_t* ptr = result.value();
+        if (std::any_of(ptr, ptr + 256, [](uint8_t byte) { return byte != 0; })) {
+            dirty++;
+        }
+    }
+    shrinker.join();
+
+    std::free(arena.buffer);
+    return dirty;
+}
+
+int main() {
+    fmt::print("Concurrent Linear Allocator Stress Example\n");
+    fmt::print("==========================================\n\n");
+
+    size_t thread_count = std::max(4u, std::thread::hardware_concurrency());
+    constexpr size_t kIterations = 20000;
+
+    auto arena_result = alloc::ConcurrentLinearAllocator::create(thread_count * kIterations * 256);
+    if (!arena_result) {
+        fmt::print("Failed to create allocator: {}\n",
+                   static_cast<int>(arena_result.error()));
+        return 1;
+    }
+
+    auto& arena = arena_result.value();
+    fmt::print("Created shared allocator with {} bytes capacity\n", arena.capacity);
+
+    std::vector<std::vector<Claim>> claims(thread_count);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < thread_count; t++) {
+        threads.emplace_back(worker, std::ref(arena), t, kIterations, std::ref(claims[t]));
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Every block must be aligned, still hold its owner's pattern and not overlap another
+    std::vector<Claim> all;
+    for (auto& list : claims) {
+        all.insert(all.end(), list.begin(), list.end());
+    }
+    std::sort(all.begin(), all.end(),
+              [](const Claim& a, const Claim& b) { return a.ptr < b.ptr; });
+
+    size_t errors = 0;
+    for (size_t i = 0; i < all.size(); i++) {
+        const Claim& claim = all[i];
+        if (reinterpret_cast<uintptr_t>(claim.ptr) % claim.alignment != 0) {
+            errors++;
+        }
+        if (i + 1 < all.size() && claim.ptr + claim.size > all[i + 1].ptr) {
+            errors++;
+        }
+        if (std::any_of(claim.ptr, claim.ptr + claim.size,
+                        [&](uint8_t byte) { return byte != claim.tag; })) {
+            errors++;
+        }
+    }
+
+    fmt::print("{} threads made {} allocations, {} bytes used\n",
+               thread_count, all.size(), arena.used.load());
+    fmt::print("Overlapping, misaligned or corrupted blocks: {}\n", errors);
+
+    size_t dirty = shrink_while_allocating(20000);
+    fmt::print("Non-zero fresh allocations while another thread shrinks: {}\n", dirty);
+    errors += dirty;
+
+    std::free(arena.buffer);
+    return errors == 0 ? 0 : 1;
+}
@@ -0,0 +1,79 @@
+// example/containers_example.cpp
+#include <fmt/core.h>
+#include "../src/LinearAllocator/ArenaContainers.hpp"
+
+int main() {
+    fmt::print("Arena Containers Example\n");
+    fmt::print("========================\n\n");
+
+    auto allocator_result = alloc::LinearAllocator::create(256 * 1024);
+    if (!allocator_result) {
+        fmt::print("Failed to create allocator: {}\n",
+                   static_cast<int>(allocator_result.error()));
+        return 1;
+    }
+
+    auto& allocator = allocator_result.value();
+
+    // A vector that is the last allocation grows in place
+    alloc::ArenaVector<int> numbers(allocator);
+    for (int i = 0; i < 1000; i++) {
+        if (!numbers.push_back(i)) {
+            fmt::print("Failed to push into vector\n");
+            return 1;
+        }
+    }
+    fmt::print("ArenaVector: {} ints, capacity {}, arena used {} bytes\n",
+               numbers.size, numbers.capacity, allocator.used);
+
+    // Elements of a segmented vector never move
+    alloc::SegmentedVector<double> samples(allocator);
+    double* first = nullptr;
+    for (int i = 0; i < 1000; i++) {
+        auto slot = samples.push_back(i * 0.25);
+        if (!slot) {
+            fmt::print("Failed to push into segmented vector\n");
+            return 1;
+        }
+        if (i == 0) {
+            first = slot.value();
+        }
+    }
+    fmt::print("SegmentedVector: {} doubles in {} segments, first element still at its address: {}\n",
+               samples.size, samples.segment_count, first == &samples[0]);
+
+    // Build a string piece by piece
+    alloc::StringBuilder builder(allocator);
+    for (int i = 0; i < 5; i++) {
+        builder.append("item-");
+        builder.append_int(i);
+        builder.append(i + 1 < 5 ? ',' : '.');
+    }
+    auto text = builder.c_str();
+    if (!text) {
+        fmt::print("Failed to terminate string\n");
+        return 1;
+    }
+    fmt::print("StringBuilder: {}\n", text.value());
+
+    // Open addressing hash map
+    alloc::FlatHashMap<int, int> squares(allocator);
+    for (int i = 0; i < 100; i++) {
+        if (!squares.insert_or_assign(i, i * i)) {
+            fmt::print("Failed to insert into map\n");
+            return 1;
+        }
+    }
+    squares.erase(10);
+    int* nine = squares.find(9);
+    fmt::print("FlatHashMap: {} entries, 9 -> {}, 10 present: {}\n",
+               squares.size, nine ? *nine : -1, squares.find(10) != nullptr);
+
+    // Everything is freed at once by resetting the arena
+    fmt::print("\nArena used before reset: {} bytes\n", allocator.used);
+    allocator.reset();
+    fmt::print("Arena used after reset: {} bytes\n", allocator.used);
+
+    std::free(allocator.buffer);
+    return 0;
+}
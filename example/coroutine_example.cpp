@@ -0,0 +1,156 @@
+// example/coroutine_example.cpp
+#include <fmt/core.h>
+#include <coroutine>
+#include <exception>
+#include <utility>
+#include "../src/LinearAllocator/ArenaCoroutine.hpp"
+
+/**
+ * @brief Minimal lazy task whose frames are allocated through ArenaPromiseBase
+ */
+template <typename T>
+struct Task {
+    struct promise_type : alloc::ArenaPromiseBase {
+        T value{};
+        std::coroutine_handle<> continuation;
+
+        Task get_return_object() {
+            return Task{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+
+        struct FinalAwaiter {
+            bool await_ready() noexcept { return false; }
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> self) noexcept {
+                auto next = self.promise().continuation;
+                return next ? next : std::noop_coroutine();
+            }
+            void await_resume() noexcept {}
+        };
+        FinalAwaiter final_suspend() noexcept { return {}; }
+
+        void return_value(T result) { value = std::move(result); }
+        void unhandled_exception() { std::terminate(); }
+    };
+
+    std::coroutine_handle<promise_type> handle;
+
+    explicit Task(std::coroutine_handle<promise_type> h) : handle(h) {}
+    Task(Task&& other) noexcept : handle(std::exchange(other.handle, nullptr)) {}
+    Task(const Task&) = delete;
+    ~Task() {
+        if (handle) {
+            handle.destroy();
+        }
+    }
+
+    bool await_ready() { return false; }
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> caller) {
+        handle.promise().continuation = caller;
+        return handle;
+    }
+    T await_resume() { return std::move(handle.promise().value); }
+
+    /**
+     * @brief Run a root task to completion
+     */
+    T run() {
+        handle.resume();
+        return std::move(handle.promise().value);
+    }
+};
+
+Task<int> lookup(alloc::LinearAllocator& arena, int key) {
+    (void)arena;
+    co_return key * 10;
+}
+
+Task<int> handle_request(alloc::LinearAllocator& arena, int request, size_t& used_inside) {
+    int total = 0;
+    for (int i = 0; i < 4; i++) {
+        total += co_await lookup(arena, request + i);
+    }
+    used_inside = arena.used;
+    co_return total;
+}
+
+/**
+ * @brief A coroutine without an arena parameter, its frame comes from the heap
+ */
+Task<int> without_arena(int value) {
+    co_return value + 1;
+}
+
+/**
+ * @brief A member coroutine: the arena follows the object
+ */
+struct Service {
+    int base = 100;
+
+    Task<int> serve(alloc::LinearAllocator& arena, int value) {
+        co_return base + co_await lookup(arena, value);
+    }
+};
+
+int main() {
+    fmt::print("Coroutine Frame Example\n");
+    fmt::print("=======================\n\n");
+
+    auto allocator_result = alloc::LinearAllocator::create(64 * 1024, false);
+    if (!allocator_result) {
+        fmt::print("Failed to create allocator: {}\n",
+                   static_cast<int>(allocator_result.error()));
+        return 1;
+    }
+    auto& arena = allocator_result.value();
+    bool ok = true;
+
+    // The root frame lives in the arena; each child gives its space back when done
+    size_t used_inside = 0;
+    {
+        Task<int> request = handle_request(arena, 1, used_inside);
+        size_t root_frame = arena.used;
+        int result = request.run();
+        fmt::print("Request result {}, arena used by the root frame {}, after 4 children: {}\n",
+                   result, root_frame, used_inside);
+        ok = ok && result == 100 && root_frame > 0 && used_inside == root_frame;
+    }
+    fmt::print("After the root task is destroyed: arena used {}\n", arena.used);
+    ok = ok && arena.used == 0;
+
+    // Frames destroyed in reverse order unwind like a stack
+    {
+        Task<int> first = handle_request(arena, 1, used_inside);
+        Task<int> second = handle_request(arena, 2, used_inside);
+        Service service;
+        Task<int> third = service.serve(arena, 3);
+        fmt::print("Three live root frames: arena used {}\n", arena.used);
+        ok = ok && first.run() == 100 && second.run() == 140 && third.run() == 130;
+    }
+    fmt::print("After they are destroyed newest first: arena used {}\n", arena.used);
+    ok = ok && arena.used == 0;
+
+    // A frame destroyed out of order stays until reset()
+    {
+        Task<int> first = handle_request(arena, 1, used_inside);
+        Task<int> second = handle_request(arena, 2, used_inside);
+        size_t first_end = arena.used;
+        {
+            Task<int> finished = std::move(first);
+            ok = ok && finished.run() == 100;
+        }
+        ok = ok && second.run() == 140 && arena.used == first_end;
+    }
+    fmt::print("After the oldest frame is destroyed first: arena used {}\n", arena.used);
+    ok = ok && arena.used > 0;
+    arena.reset();
+    ok = ok && arena.used == 0;
+
+    // No arena parameter: the frame is heap-allocated
+    Task<int> heap_task = without_arena(41);
+    ok = ok && heap_task.run() == 42 && arena.used == 0;
+    fmt::print("Coroutine without an arena ran from the heap: {}\n", ok);
+
+    std::free(arena.buffer);
+    return ok ? 0 : 1;
+}
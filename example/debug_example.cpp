@@ -0,0 +1,75 @@
+// example/debug_example.cpp
+#include <fmt/core.h>
+#include "../src/LinearAllocator/LinearAllocator.hpp"
+
+#ifndef LINEAR_ALLOCATOR_DEBUG
+#error "debug_example must be built with LINEAR_ALLOCATOR_DEBUG"
+#endif
+
+int main() {
+    fmt::print("Arena Debug Mode Example\n");
+    fmt::print("========================\n\n");
+
+#ifdef LINEAR_ALLOCATOR_ASAN
+    fmt::print("AddressSanitizer: on, freed memory and guard zones are poisoned\n\n");
+#else
+    fmt::print("AddressSanitizer: off, freed memory is filled and guards are checked\n\n");
+#endif
+
+    auto allocator_result = alloc::LinearAllocator::create(4096, false);
+    if (!allocator_result) {
+        fmt::print("Failed to create allocator: {}\n",
+                   static_cast<int>(allocator_result.error()));
+        return 1;
+    }
+
+    auto& allocator = allocator_result.value();
+    bool ok = true;
+
+    // Every allocation gets a guard zone in front of it
+    uint8_t* first = allocator.allocate<uint8_t>(40).value();
+    uint8_t* second = allocator.allocate<uint8_t>(40).value();
+    size_t gap = static_cast<size_t>(second - (first + 40));
+    ok = ok && gap >= alloc::kRedzoneBytes && first[0] == alloc::kAllocatedPattern;
+    fmt::print("Gap between two 40-byte allocations: {} bytes, new memory reads 0x{:02X}\n",
+               gap, first[0]);
+    ok = ok && allocator.guards_intact();
+
+    // Memory rolled back by a savepoint is filled and, under ASan, poisoned
+    uint8_t* scratch = nullptr;
+    {
+        auto temp = alloc::TempArenaMemory::begin(allocator);
+        scratch = allocator.allocate<uint8_t>(128).value();
+        scratch[0] = 42;
+    }
+#ifdef LINEAR_ALLOCATOR_ASAN
+    bool stale_caught = alloc::memory_is_poisoned(scratch);
+    bool guard_caught = alloc::memory_is_poisoned(first + 40);
+    fmt::print("Rolled-back memory poisoned: {}, guard after an allocation poisoned: {}\n",
+               stale_caught, guard_caught);
+    ok = ok && stale_caught && guard_caught;
+#else
+    bool stale_caught = scratch[0] == alloc::kFreedPattern;
+    fmt::print("Rolled-back memory now reads 0x{:02X}\n", scratch[0]);
+    ok = ok && stale_caught;
+
+    // A one-byte overflow lands in the next guard zone and is found by the check
+    uint8_t saved = first[40];
+    first[40] = 0;
+    size_t bad_offset = 0;
+    bool intact = allocator.guards_intact(&bad_offset);
+    fmt::print("After a one-byte overflow: guards intact {}, damage at offset {} (allocation ends at {})\n",
+               intact, bad_offset, static_cast<size_t>(first + 40 - allocator.buffer));
+    ok = ok && !intact && allocator.buffer + bad_offset == first + 40;
+
+    // reset() would abort on the damaged guard, so repair it for this example
+    first[40] = saved;
+#endif
+
+    allocator.reset();
+    fmt::print("Reset with intact guards: ok\n");
+
+    allocator.unpoison();
+    std::free(allocator.buffer);
+    return ok ? 0 : 1;
+}
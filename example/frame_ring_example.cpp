@@ -0,0 +1,120 @@
+// example/frame_ring_example.cpp
+#include <fmt/core.h>
+#include <thread>
+#include "../src/LinearAllocator/FrameArena.hpp"
+
+/**
+ * @brief Data one pipeline stage hands to the next for a single frame
+ */
+struct FrameData {
+    uint64_t frame;
+    uint32_t* values;
+    size_t count;
+};
+
+constexpr uint64_t kFrameCount = 2000;
+
+int main() {
+    fmt::print("Frame Arena Example\n");
+    fmt::print("===================\n\n");
+
+    auto ring_result = alloc::FrameArenaRing<3>::create(64 * 1024);
+    if (!ring_result) {
+        fmt::print("Failed to create frame ring: {}\n",
+                   static_cast<int>(ring_result.error()));
+        return 1;
+    }
+
+    auto& frames = ring_result.value();
+    uint64_t bad_frames = 0;
+    uint64_t checksum = 0;
+
+    // The consumer reads each frame while the producer builds the next ones
+    std::thread consumer([&] {
+        for (uint64_t expected = 0; expected < kFrameCount; expected++) {
+            alloc::FrameView view = frames.wait_acquire_frame();
+            auto* data = static_cast<FrameData*>(view.payload);
+            if (view.frame != expected || data->frame != expected) {
+                bad_frames++;
+            }
+            for (size_t i = 0; i < data->count; i++) {
+                if (data->values[i] != static_cast<uint32_t>(expected * 31 + i)) {
+                    bad_frames++;
+                    break;
+                }
+                checksum += data->values[i];
+            }
+            frames.release_frame();
+        }
+    });
+
+    uint64_t expected_checksum = 0;
+    for (uint64_t frame = 0; frame < kFrameCount; frame++) {
+        alloc::LinearAllocator* arena = frames.wait_begin_frame().value();
+
+        size_t count = 64 + frame % 512;
+        auto* data = arena->allocate<FrameData>().value();
+        data->frame = frame;
+        data->count = count;
+        data->values = arena->allocate<uint32_t>(count).value();
+        for (size_t i = 0; i < count; i++) {
+            data->values[i] = static_cast<uint32_t>(frame * 31 + i);
+            expected_checksum += data->values[i];
+        }
+
+        frames.end_frame(data);
+    }
+    consumer.join();
+
+    bool ok = bad_frames == 0 && checksum == expected_checksum;
+    fmt::print("FrameArenaRing<3>: {} frames handed over, {} bad, checksum match: {}\n",
+               kFrameCount, bad_frames, checksum == expected_checksum);
+
+    // With nothing released, the producer can run at most 3 frames ahead
+    for (int i = 0; i < 3; i++) {
+        frames.begin_frame().value();
+        frames.end_frame();
+    }
+    auto blocked = frames.begin_frame();
+    ok = ok && !blocked && blocked.error() == alloc::AllocError::WouldBlock;
+    fmt::print("Fourth unreleased frame blocks: {}\n", !blocked);
+    frames.destroy();
+
+    // Ring allocator: the offset wraps and the oldest messages are reclaimed in order
+    auto ring_alloc_result = alloc::RingAllocator::create(1024);
+    if (!ring_alloc_result) {
+        fmt::print("Failed to create ring allocator: {}\n",
+                   static_cast<int>(ring_alloc_result.error()));
+        return 1;
+    }
+
+    auto& ring = ring_alloc_result.value();
+    uint64_t marks[4];
+    uint8_t* first = nullptr;
+    for (int i = 0; i < 4; i++) {
+        auto* message = ring.allocate<uint8_t>(200).value();
+        if (i == 0) {
+            first = message;
+        }
+        marks[i] = ring.mark();
+    }
+    fmt::print("\nRingAllocator: {} bytes in use after 4 messages\n", ring.in_use());
+
+    // The fifth message does not fit before the end and the first one is still live
+    auto full = ring.allocate<uint8_t>(300);
+    ok = ok && !full && full.error() == alloc::AllocError::WouldBlock;
+    fmt::print("Fifth message blocks while the oldest is live: {}\n", !full);
+
+    // Reclaiming the two oldest messages lets the offset wrap to the start
+    ring.release_until(marks[1]);
+    auto wrapped = ring.allocate<uint8_t>(300);
+    ok = ok && wrapped && wrapped.value() == first;
+    fmt::print("After releasing 2 messages the fifth wraps to the start: {}, {} bytes in use\n",
+               wrapped && wrapped.value() == first, ring.in_use());
+
+    auto too_big = ring.allocate<uint8_t>(2048);
+    ok = ok && !too_big && too_big.error() == alloc::AllocError::OutOfMemory;
+
+    std::free(ring.buffer);
+    return ok ? 0 : 1;
+}
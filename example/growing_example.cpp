@@ -0,0 +1,87 @@
+// example/growing_example.cpp
+#include <fmt/core.h>
+#include "../src/LinearAllocator/GrowingLinearAllocator.hpp"
+
+/**
+ * @brief Count the blocks currently chained by a growing allocator
+ *
+ * @param alloc Reference to a growing linear allocator
+ * @return size_t Number of blocks in the chain
+ */
+size_t count_blocks(const alloc::GrowingLinearAllocator& alloc) {
+    size_t count = 0;
+    for (alloc::ArenaBlock* block = alloc.first_block; block; block = block->next) {
+        count++;
+    }
+    return count;
+}
+
+int main() {
+    fmt::print("Growing Linear Allocator Example\n");
+    fmt::print("================================\n\n");
+
+    // Start with a small 256 byte block and double the block size when it fills up
+    auto allocator_result = alloc::GrowingLinearAllocator::create(256, alloc::GrowthPolicy::Geometric);
+    if (!allocator_result) {
+        fmt::print("Failed to create allocator: {}\n",
+                   static_cast<int>(allocator_result.error()));
+        return 1;
+    }
+
+    auto& allocator = allocator_result.value();
+    fmt::print("Created allocator with a {} byte first block\n", allocator.block_size);
+
+    // Allocate more than the first block can hold
+    for (int i = 0; i < 10; i++) {
+        auto ints_result = allocator.allocate<int>(32);
+        if (!ints_result) {
+            fmt::print("Failed to allocate ints: {}\n",
+                       static_cast<int>(ints_result.error()));
+            return 1;
+        }
+
+        int* ints = ints_result.value();
+        for (int j = 0; j < 32; j++) {
+            ints[j] = i * 32 + j;
+        }
+    }
+    fmt::print("After 10 allocations of 128 bytes: {} blocks, {} bytes total\n",
+               count_blocks(allocator), allocator.total_capacity());
+
+    // A savepoint taken in one block is rolled back even after moving to a new block
+    {
+        auto temp = alloc::TempGrowingArenaMemory::begin(allocator);
+        alloc::ArenaBlock* block_before = allocator.current_block;
+
+        auto big_result = allocator.allocate<double>(512);
+        if (!big_result) {
+            fmt::print("Failed to allocate temporary data: {}\n",
+                       static_cast<int>(big_result.error()));
+            return 1;
+        }
+
+        fmt::print("\nTemporary allocation moved to a new block: {}\n",
+                   allocator.current_block != block_before);
+        fmt::print("Blocks during temporary scope: {}\n", count_blocks(allocator));
+    }
+    fmt::print("Used in current block after rollback: {} bytes\n", allocator.arena.used);
+
+    // Reset keeps every block, so refilling does not allocate new blocks
+    size_t blocks_before_reset = count_blocks(allocator);
+    allocator.reset();
+    for (int i = 0; i < 10; i++) {
+        auto ints_result = allocator.allocate<int>(32);
+        if (!ints_result) {
+            fmt::print("Failed to allocate ints after reset: {}\n",
+                       static_cast<int>(ints_result.error()));
+            return 1;
+        }
+    }
+    fmt::print("\nBlocks before reset: {}, after refilling: {}\n",
+               blocks_before_reset, count_blocks(allocator));
+
+    // Free every block owned by the allocator
+    allocator.destroy();
+
+    return 0;
+}
@@ -0,0 +1,104 @@
+// example/objects_example.cpp
+#include <fmt/core.h>
+#include <string>
+#include <vector>
+#include "../src/LinearAllocator/GrowingLinearAllocator.hpp"
+
+/**
+ * @brief Number of Tracked objects currently alive
+ */
+static int g_alive = 0;
+
+/**
+ * @brief A type with a non-trivial destructor that counts live instances
+ */
+struct Tracked {
+    std::string name;
+    std::vector<int> values;
+
+    Tracked(std::string tracked_name, int value_count)
+        : name(std::move(tracked_name)), values(value_count, 7) {
+        g_alive++;
+    }
+
+    ~Tracked() {
+        g_alive--;
+    }
+};
+
+/**
+ * @brief A plain struct, made without any destructor bookkeeping
+ */
+struct Point {
+    float x, y;
+};
+
+int main() {
+    fmt::print("Typed Object Construction Example\n");
+    fmt::print("=================================\n\n");
+
+    auto allocator_result = alloc::LinearAllocator::create(64 * 1024);
+    if (!allocator_result) {
+        fmt::print("Failed to create allocator: {}\n",
+                   static_cast<int>(allocator_result.error()));
+        return 1;
+    }
+
+    auto& allocator = allocator_result.value();
+    bool ok = true;
+
+    // Trivially destructible types register nothing
+    auto point = allocator.make<Point>(1.0f, 2.0f);
+    fmt::print("Point ({}, {}), destructor list empty: {}\n",
+               point.value()->x, point.value()->y, allocator.destructors == nullptr);
+    ok = ok && allocator.destructors == nullptr;
+
+    // Objects that own heap memory are destroyed on reset
+    auto first = allocator.make<Tracked>("first", 100);
+    auto many = allocator.make_array<Tracked>(4, std::string("element"), 10);
+    if (!first || !many) {
+        fmt::print("Failed to make objects\n");
+        return 1;
+    }
+    fmt::print("Made {} with {} values and an array of 4, alive: {}\n",
+               first.value()->name, first.value()->values.size(), g_alive);
+
+    // Rolling back a savepoint destroys only what was made after it
+    {
+        auto temp = alloc::TempArenaMemory::begin(allocator);
+        allocator.make<Tracked>("temporary", 1000);
+        fmt::print("Inside savepoint, alive: {}\n", g_alive);
+    }
+    fmt::print("After savepoint, alive: {}\n", g_alive);
+    ok = ok && g_alive == 5;
+
+    allocator.reset();
+    fmt::print("After reset, alive: {}\n", g_alive);
+    ok = ok && g_alive == 0;
+    std::free(allocator.buffer);
+
+    // Growing arenas track destructors across blocks
+    auto growing_result = alloc::GrowingLinearAllocator::create(256);
+    if (!growing_result) {
+        fmt::print("Failed to create growing allocator\n");
+        return 1;
+    }
+
+    auto& growing = growing_result.value();
+    for (int i = 0; i < 50; i++) {
+        if (!growing.make<Tracked>(fmt::format("object-{}", i), 8)) {
+            fmt::print("Failed to make object in growing arena\n");
+            return 1;
+        }
+    }
+    fmt::print("\nGrowing arena: {} objects alive over {} bytes of blocks\n",
+               g_alive, growing.total_capacity());
+    ok = ok && g_alive == 50;
+
+    growing.destroy();
+    fmt::print("After destroy, alive: {}\n", g_alive);
+    ok = ok && g_alive == 0;
+
+    fmt::print("\n{}\n", ok ? "All destructors ran" : "Destructor count mismatch");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,97 @@
+// example/owning_example.cpp
+#include <fmt/core.h>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../src/LinearAllocator/OwningArena.hpp"
+
+/**
+ * @brief Counts destructor runs, so the example can check the arena ran them
+ */
+struct Session {
+    static inline int destroyed = 0;
+    std::string user;
+
+    explicit Session(std::string name) : user(std::move(name)) {}
+    ~Session() { destroyed++; }
+};
+
+/**
+ * @brief Arena for one request, returned by value: the memory moves with it
+ */
+std::expected<alloc::OwningArena, alloc::AllocError> build_request(alloc::ArenaRecycler& recycler) {
+    auto arena = recycler.acquire(false);
+    if (!arena) {
+        return arena;
+    }
+    arena->make<Session>("request user").value();
+    arena->allocate<uint8_t>(1024).value();
+    return arena;
+}
+
+int main() {
+    fmt::print("Owning Arena Example\n");
+    fmt::print("====================\n\n");
+
+    bool ok = true;
+
+    // The destructor runs registered destructors and frees the memory
+    {
+        auto arena = alloc::OwningArena::create(16 * 1024).value();
+        arena.make<Session>("malloc").value();
+
+        // Moving transfers ownership, the moved-from arena owns nothing
+        alloc::OwningArena moved = std::move(arena);
+        fmt::print("After a move: source owns memory {}, target owns memory {}\n",
+                   static_cast<bool>(arena), static_cast<bool>(moved));
+        ok = ok && !arena && moved && moved.arena.used > 0;
+    }
+    fmt::print("Destructors run when the owning arena went out of scope: {}\n", Session::destroyed);
+    ok = ok && Session::destroyed == 1;
+
+    // Pluggable backing sources
+    auto parent = alloc::LinearAllocator::create(64 * 1024).value();
+    {
+        auto mapped = alloc::OwningArena::create(10000, true, alloc::mmap_backing());
+        uint8_t stack_buffer[4096];
+        auto on_stack = alloc::OwningArena::create(1024, true,
+                                                   alloc::buffer_backing(stack_buffer, sizeof(stack_buffer)));
+        auto child = alloc::OwningArena::create(8 * 1024, true, alloc::parent_backing(parent));
+        if (!mapped || !on_stack || !child) {
+            fmt::print("Failed to create arenas from the backing sources\n");
+            return 1;
+        }
+        fmt::print("mmap backing: asked for 10000 bytes, got {} (page rounded)\n", mapped->arena.capacity);
+        fmt::print("Buffer backing: the arena uses the whole {}-byte buffer\n", on_stack->arena.capacity);
+        fmt::print("Parent backing: parent used {} bytes after carving the child\n", parent.used);
+        ok = ok && mapped->arena.capacity >= 10000 && on_stack->arena.buffer == stack_buffer &&
+             on_stack->arena.capacity == sizeof(stack_buffer) && parent.used >= 8 * 1024;
+
+        // A buffer source cannot provide more than the buffer
+        ok = ok && !alloc::OwningArena::create(8192, true,
+                                               alloc::buffer_backing(stack_buffer, sizeof(stack_buffer)));
+    }
+
+    // Request-scoped arenas come from the recycler's free list once warmed up
+    alloc::ArenaRecycler recycler(32 * 1024, 4);
+    std::vector<alloc::OwningArena> in_flight;
+    for (int i = 0; i < 4; i++) {
+        in_flight.push_back(build_request(recycler).value());
+    }
+    in_flight.clear();
+    fmt::print("\n4 requests done, buffers cached by the recycler: {}\n", recycler.cached);
+    ok = ok && recycler.cached == 4;
+
+    auto next = build_request(recycler).value();
+    bool reused = recycler.cached == 3;
+    fmt::print("Next request reused a cached buffer: {}\n", reused);
+    ok = ok && reused && Session::destroyed == 5;
+
+    recycler.trim(1);
+    fmt::print("After trim(1): {} cached\n", recycler.cached);
+    ok = ok && recycler.cached == 1;
+
+    parent.unpoison();
+    std::free(parent.buffer);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,147 @@
+// example/persistent_example.cpp
+#include <fmt/core.h>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include "../src/LinearAllocator/PersistentArena.hpp"
+
+/**
+ * @brief One entry of a lookup table that is built once and reused by later runs
+ */
+struct Record {
+    uint64_t key;
+    alloc::rel_ptr<char> name;
+};
+
+/**
+ * @brief Root of the table, sorted by key
+ */
+struct Index {
+    uint64_t count;
+    alloc::rel_ptr<Record> records;
+};
+
+constexpr uint64_t kRecords = 10000;
+
+/**
+ * @brief Binary search for a key, returns the record or nullptr
+ */
+const Record* find(const Index* index, uint64_t key) {
+    uint64_t low = 0;
+    uint64_t high = index->count;
+    while (low < high) {
+        uint64_t mid = (low + high) / 2;
+        if (index->records[mid].key < key) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low < index->count && index->records[low].key == key ? &index->records[low] : nullptr;
+}
+
+/**
+ * @brief Check every record of an index, returns the number of mismatches
+ */
+uint64_t verify(const Index* index) {
+    uint64_t bad = index && index->count == kRecords ? 0 : 1;
+    for (uint64_t i = 0; index && i < kRecords; i++) {
+        const Record* record = find(index, i * 3);
+        char expected[32] = {};
+        fmt::format_to_n(expected, sizeof(expected) - 1, "record-{}", i);
+        if (!record || std::strcmp(record->name.get(), expected) != 0) {
+            bad++;
+        }
+    }
+    return bad;
+}
+
+int main() {
+    fmt::print("Persistent Arena Example\n");
+    fmt::print("========================\n\n");
+
+    std::string path = (std::filesystem::temp_directory_path() / "linear_allocator_index.arena").string();
+    std::filesystem::remove(path);
+    bool ok = true;
+
+    // First run: build the index and checkpoint it
+    {
+        auto arena_result = alloc::PersistentArena::create_from_file(path.c_str(), 4 * 1024 * 1024);
+        if (!arena_result) {
+            fmt::print("Failed to create persistent arena: {}\n",
+                       static_cast<int>(arena_result.error()));
+            return 1;
+        }
+
+        auto& arena = arena_result.value();
+        auto* index = arena.allocate<Index>().value();
+        index->count = kRecords;
+        index->records = arena.allocate<Record>(kRecords).value();
+        for (uint64_t i = 0; i < kRecords; i++) {
+            char name[32];
+            auto written = fmt::format_to_n(name, sizeof(name), "record-{}", i);
+            char* stored = arena.allocate<char>(written.size + 1).value();
+            std::memcpy(stored, name, written.size);
+            index->records[i].key = i * 3;
+            index->records[i].name = stored;
+        }
+        arena.set_root(index);
+        ok = ok && !arena.restored && arena.sync();
+        fmt::print("Built {} records, {} bytes used, file {}\n", kRecords, arena.arena.used, path);
+        arena.destroy();
+    }
+
+    // Later run: map the file and use the index right away
+    {
+        auto start = std::chrono::steady_clock::now();
+        auto arena_result = alloc::PersistentArena::create_from_file(path.c_str(), 4 * 1024 * 1024);
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        if (!arena_result) {
+            fmt::print("Failed to open persistent arena: {}\n",
+                       static_cast<int>(arena_result.error()));
+            return 1;
+        }
+
+        auto& arena = arena_result.value();
+        uint64_t bad = verify(arena.root<Index>());
+        ok = ok && arena.restored && bad == 0;
+        fmt::print("Reopened in {} us: restored {}, {} bytes used, {} bad records\n",
+                   std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count(),
+                   arena.restored, arena.arena.used, bad);
+
+        // A second mapping of the same file lands at another address; rel_ptrs still resolve
+        auto second = alloc::PersistentArena::create_from_file(path.c_str(), 0).value();
+        uint64_t bad_second = verify(second.root<Index>());
+        ok = ok && second.arena.buffer != arena.arena.buffer && bad_second == 0;
+        fmt::print("Second mapping at a different address: {}, {} bad records\n",
+                   second.arena.buffer != arena.arena.buffer, bad_second);
+        second.destroy();
+
+        // Allocations after the last checkpoint are dropped when the file is reopened
+        size_t checkpoint = arena.arena.used;
+        arena.allocate<uint64_t>(1000).value();
+        arena.destroy();
+
+        auto reopened = alloc::PersistentArena::create_from_file(path.c_str(), 0).value();
+        ok = ok && reopened.arena.used == checkpoint;
+        fmt::print("Unsynced allocations dropped on reopen: {}\n", reopened.arena.used == checkpoint);
+        reopened.destroy();
+    }
+
+    // A file that is not a persistent arena is refused and left as it was
+    {
+        std::filesystem::remove(path);
+        std::FILE* other = std::fopen(path.c_str(), "w");
+        std::fputs("not an arena", other);
+        std::fclose(other);
+
+        auto refused = alloc::PersistentArena::create_from_file(path.c_str(), 4096);
+        bool untouched = std::filesystem::file_size(path) == 12;
+        ok = ok && !refused && refused.error() == alloc::AllocError::FileError && untouched;
+        fmt::print("Foreign file refused: {}, left untouched: {}\n", !refused, untouched);
+    }
+
+    std::filesystem::remove(path);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,91 @@
+// example/pmr_example.cpp
+#include <fmt/core.h>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "../src/LinearAllocator/ArenaResource.hpp"
+
+/**
+ * @brief Number of calls to the global operator new, to show containers stay off the heap
+ */
+static size_t g_heap_allocations = 0;
+
+void* operator new(size_t size) {
+    g_heap_allocations++;
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    std::free(ptr);
+}
+
+int main() {
+    fmt::print("PMR and STL Allocator Example\n");
+    fmt::print("=============================\n\n");
+
+    auto allocator_result = alloc::LinearAllocator::create(64 * 1024);
+    if (!allocator_result) {
+        fmt::print("Failed to create allocator: {}\n",
+                   static_cast<int>(allocator_result.error()));
+        return 1;
+    }
+
+    auto& allocator = allocator_result.value();
+    alloc::ArenaMemoryResource resource(allocator);
+    size_t heap_before = g_heap_allocations;
+
+    // std::pmr containers allocate through the resource
+    {
+        std::pmr::vector<int> numbers(&resource);
+        for (int i = 0; i < 100; i++) {
+            numbers.push_back(i * i);
+        }
+
+        std::pmr::string text("arena backed strings do not touch the heap", &resource);
+
+        std::pmr::unordered_map<int, std::pmr::string> names(&resource);
+        names.emplace(1, "one");
+        names.emplace(2, "two");
+        names.emplace(3, "a string long enough to need its own buffer");
+
+        fmt::print("vector size: {}, last: {}\n", numbers.size(), numbers.back());
+        fmt::print("string: {}\n", text);
+        fmt::print("map[3]: {}\n", names[3]);
+        fmt::print("Arena used by pmr containers: {} bytes\n", allocator.used);
+    }
+
+    // A stateful STL allocator works with the regular container templates
+    allocator.reset();
+    {
+        std::vector<double, alloc::ArenaAllocator<double>> values{alloc::ArenaAllocator<double>(allocator)};
+        values.reserve(16);
+        for (int i = 0; i < 16; i++) {
+            values.push_back(i * 0.5);
+        }
+        fmt::print("\nstd::vector with ArenaAllocator: {} values, arena used: {} bytes\n",
+                   values.size(), allocator.used);
+
+        // Freeing the most recent block gives its space back
+        size_t used_before = allocator.used;
+        alloc::ArenaAllocator<int> ints(allocator);
+        int* scratch = ints.allocate(256);
+        fmt::print("After allocating 256 ints: {} bytes\n", allocator.used);
+        ints.deallocate(scratch, 256);
+        fmt::print("After deallocating them: {} bytes (was {})\n", allocator.used, used_before);
+    }
+
+    size_t heap_calls = g_heap_allocations - heap_before;
+    fmt::print("\nGlobal operator new calls while using the arena: {}\n", heap_calls);
+
+    std::free(allocator.buffer);
+    return heap_calls == 0 ? 0 : 1;
+}
@@ -0,0 +1,93 @@
+// example/pool_example.cpp
+#include <fmt/core.h>
+#include <vector>
+#include "../src/LinearAllocator/PoolAllocator.hpp"
+
+/**
+ * @brief A uniformly sized object that churns constantly
+ */
+struct Connection {
+    uint64_t id;
+    uint32_t state;
+    char peer[44];
+};
+
+int main() {
+    fmt::print("Pool Allocator Example\n");
+    fmt::print("======================\n\n");
+
+    auto allocator_result = alloc::LinearAllocator::create(256 * 1024);
+    if (!allocator_result) {
+        fmt::print("Failed to create allocator: {}\n",
+                   static_cast<int>(allocator_result.error()));
+        return 1;
+    }
+
+    auto& arena = allocator_result.value();
+    bool ok = true;
+
+    {
+        alloc::PoolAllocator pool(arena, sizeof(Connection), alignof(Connection), 32);
+
+        // Churn: at most 100 connections are alive, 10000 are opened in total
+        std::vector<Connection*> open;
+        for (uint64_t i = 0; i < 10000; i++) {
+            if (open.size() == 100) {
+                pool.destroy(open[i % 100]);
+                open[i % 100] = pool.make<Connection>(Connection{i, 1, "peer"}).value();
+            } else {
+                open.push_back(pool.make<Connection>(Connection{i, 1, "peer"}).value());
+            }
+        }
+        fmt::print("10000 connections opened, 100 alive, arena used: {} bytes\n", arena.used);
+        ok = ok && arena.used < 100 * 2 * sizeof(Connection);
+
+        // A rollback returns the slabs carved inside it; the pool forgets them
+        size_t used_before = arena.used;
+        {
+            auto temp = alloc::TempArenaMemory::begin(arena);
+            std::vector<void*> burst;
+            for (int i = 0; i < 500; i++) {
+                burst.push_back(pool.allocate().value());
+            }
+            fmt::print("Burst of 500 inside a savepoint, arena used: {} bytes\n", arena.used);
+            for (void* chunk : burst) {
+                pool.free(chunk);
+            }
+        }
+        fmt::print("After the rollback, arena used: {} bytes (was {})\n", arena.used, used_before);
+        ok = ok && arena.used == used_before;
+
+        // Every chunk handed out now lies below the savepoint
+        for (int i = 0; i < 200; i++) {
+            void* chunk = pool.allocate().value();
+            ok = ok && static_cast<uint8_t*>(chunk) < arena.buffer + arena.used;
+        }
+    }
+
+    // Size classes in front of the same arena
+    arena.reset();
+    {
+        alloc::SizeClassPool<> classes(arena);
+        size_t sizes[] = {8, 24, 100, 500, 2000, 5000};
+        for (size_t size : sizes) {
+            void* first = classes.allocate_bytes(size).value();
+            classes.free(first, size);
+            void* second = classes.allocate_bytes(size).value();
+            size_t index = classes.class_index(size);
+            bool reused = first == second;
+            fmt::print("{:>5} bytes -> class {} ({} byte chunks), chunk reused: {}\n", size, index,
+                       index < 8 ? classes.classes[index].chunk_size : size, reused);
+            ok = ok && (reused || index == 8);
+        }
+
+        // Resetting the parent drops every slab of every class
+        arena.reset();
+        ok = ok && classes.classes[0].slabs == nullptr && classes.classes[0].free_list == nullptr;
+        fmt::print("After parent reset, class slabs dropped: {}\n", classes.classes[0].slabs == nullptr);
+    }
+
+    std::free(arena.buffer);
+    fmt::print("\n{}\n", ok ? "All checks passed" : "Check failed");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,95 @@
+// example/scratch_example.cpp
+#include <fmt/core.h>
+#include <cstring>
+#include "../src/LinearAllocator/ScratchArena.hpp"
+
+/**
+ * @brief Build the squares of 0..count-1 in `out`, using scratch memory for the work
+ *
+ * `out` may itself be a scratch arena of the caller, so it is passed as a conflict.
+ */
+uint64_t* squares(alloc::LinearAllocator& out, size_t count, bool& separate) {
+    auto scratch = alloc::get_scratch({&out}).value();
+    separate = &scratch.arena() != &out;
+
+    // Temporaries live on the other scratch arena and never split the result
+    uint64_t* work = scratch.allocate<uint64_t>(count).value();
+    for (size_t i = 0; i < count; i++) {
+        work[i] = i * i;
+    }
+
+    uint64_t* result = out.allocate<uint64_t>(count).value();
+    std::memcpy(result, work, count * sizeof(uint64_t));
+    return result;
+}
+
+/**
+ * @brief Recurse with a scratch scope at every level, the scopes nest on one arena
+ */
+size_t depth_sum(size_t depth) {
+    if (depth == 0) {
+        return 0;
+    }
+    auto scratch = alloc::get_scratch().value();
+    size_t* level = scratch.allocate<size_t>(64).value();
+    level[0] = depth;
+    return level[0] + depth_sum(depth - 1);
+}
+
+int main() {
+    fmt::print("Scratch Arena Example\n");
+    fmt::print("=====================\n\n");
+
+    bool ok = true;
+
+    // Ending a savepoint restores the last allocation too, so resize grows in place
+    auto allocator_result = alloc::LinearAllocator::create(4096);
+    if (!allocator_result) {
+        fmt::print("Failed to create allocator: {}\n",
+                   static_cast<int>(allocator_result.error()));
+        return 1;
+    }
+    auto& allocator = allocator_result.value();
+    int* values = allocator.allocate<int>(16).value();
+    {
+        auto temp = alloc::TempArenaMemory::begin(allocator);
+        allocator.allocate<int>(64).value();
+    }
+    int* grown = allocator.resize<int>(values, 16, 32).value();
+    fmt::print("Resize after a rolled-back scope grew in place: {}\n", grown == values);
+    ok = ok && grown == values &&
+         allocator.buffer + allocator.used == reinterpret_cast<uint8_t*>(values + 32);
+
+    // A caller building results in a scratch arena gets temporaries on the other one
+    {
+        auto outer = alloc::get_scratch().value();
+        bool separate = false;
+        uint64_t* first = squares(outer.arena(), 100, separate);
+        uint64_t* second = squares(outer.arena(), 100, separate);
+        // Only a debug mode guard zone may sit between the two results
+        size_t gap = static_cast<size_t>(reinterpret_cast<uint8_t*>(second) -
+                                         reinterpret_cast<uint8_t*>(first + 100));
+        bool contiguous = second > first && gap <= alloc::kRedzoneBytes + alignof(uint64_t) - 1;
+        fmt::print("Results built in a scratch arena are back to back: {}, temporaries elsewhere: {}\n",
+                   contiguous, separate);
+        ok = ok && contiguous && separate && second[99] == 99 * 99;
+    }
+    ok = ok && alloc::thread_scratch_arenas()[0].arena.used == 0 &&
+         alloc::thread_scratch_arenas()[1].arena.used == 0;
+
+    // Deep call chains take temporaries from the scratch arena instead of the heap
+    size_t sum = depth_sum(200);
+    fmt::print("Sum over 200 nested scratch scopes: {}, scratch arena used afterwards: {}\n",
+               sum, alloc::thread_scratch_arenas()[0].arena.used);
+    ok = ok && sum == 200 * 201 / 2 && alloc::thread_scratch_arenas()[0].arena.used == 0;
+
+    // With every scratch arena in conflict there is nothing to hand out
+    auto a = alloc::get_scratch().value();
+    auto b = alloc::get_scratch({&a.arena()}).value();
+    bool refused = !alloc::get_scratch({&a.arena(), &b.arena()});
+    fmt::print("Request conflicting with every scratch arena refused: {}\n", refused);
+    ok = ok && refused;
+
+    std::free(allocator.buffer);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,122 @@
+// example/shared_example.cpp
+#include <fmt/core.h>
+#include <cstdio>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "../src/LinearAllocator/SharedArena.hpp"
+
+constexpr uint64_t kMessages = 20000;
+
+/**
+ * @brief Value of word `i` of message `sequence`, so the reader can check every byte
+ */
+uint32_t pattern(uint64_t sequence, size_t i) {
+    return static_cast<uint32_t>(sequence * 2654435761u + i);
+}
+
+/**
+ * @brief What the producer writes to the pipe: the message reference and its number
+ */
+struct Envelope {
+    alloc::SharedRef ref;
+    uint64_t sequence;
+};
+
+/**
+ * @brief Child process: read references from the pipe and check each message in place
+ *
+ * @return int 0 if no message was corrupted
+ */
+int run_reader(alloc::SharedArena& arena, int pipe_in) {
+    size_t slot = arena.register_reader().value();
+    uint64_t delivered = 0;
+    uint64_t expired = 0;
+    uint64_t corrupted = 0;
+
+    Envelope envelope;
+    while (read(pipe_in, &envelope, sizeof(envelope)) == sizeof(envelope)) {
+        auto message = arena.pin(slot, envelope.ref);
+        if (!message) {
+            expired++;
+            continue;
+        }
+
+        const auto* words = reinterpret_cast<const uint32_t*>(message.value());
+        for (size_t i = 0; i < envelope.ref.size / sizeof(uint32_t); i++) {
+            if (words[i] != pattern(envelope.sequence, i)) {
+                corrupted++;
+                break;
+            }
+        }
+        arena.unpin(slot);
+        delivered++;
+    }
+
+    arena.unregister_reader(slot);
+    fmt::print("Reader: {} messages checked in place, {} expired before they were read, {} corrupted\n",
+               delivered, expired, corrupted);
+    return corrupted == 0 && delivered > 0 ? 0 : 1;
+}
+
+int main() {
+    fmt::print("Shared Arena Example\n");
+    fmt::print("====================\n\n");
+
+    auto arena_result = alloc::SharedArena::create(1024 * 1024, false);
+    if (!arena_result) {
+        fmt::print("Failed to create shared arena: {}\n",
+                   static_cast<int>(arena_result.error()));
+        return 1;
+    }
+
+    auto& arena = arena_result.value();
+    int pipe_fds[2];
+    if (pipe(pipe_fds) != 0) {
+        fmt::print("Failed to create pipe\n");
+        return 1;
+    }
+
+    // The child inherits the shared mapping, only references go through the pipe
+    std::fflush(stdout);
+    pid_t child = fork();
+    if (child == 0) {
+        close(pipe_fds[1]);
+        int code = run_reader(arena, pipe_fds[0]);
+        arena.destroy();
+        std::fflush(stdout);
+        _exit(code);
+    }
+    close(pipe_fds[0]);
+
+    uint64_t resets = 0;
+    for (uint64_t sequence = 0; sequence < kMessages; sequence++) {
+        size_t words = 16 + (sequence * 37) % 1024;
+        auto message = arena.allocate<uint32_t>(words);
+        if (!message) {
+            // The generation is full: move on to the other one
+            arena.reset();
+            resets++;
+            message = arena.allocate<uint32_t>(words);
+        }
+
+        for (size_t i = 0; i < words; i++) {
+            message.value()[i] = pattern(sequence, i);
+        }
+
+        Envelope envelope{arena.ref(message.value(), words * sizeof(uint32_t)), sequence};
+        if (write(pipe_fds[1], &envelope, sizeof(envelope)) != sizeof(envelope)) {
+            fmt::print("Failed to send message {}\n", sequence);
+            break;
+        }
+    }
+    close(pipe_fds[1]);
+
+    int status = 0;
+    waitpid(child, &status, 0);
+    bool ok = WIFEXITED(status) && WEXITSTATUS(status) == 0;
+    fmt::print("Producer: {} messages sent with {} resets, reader {}\n",
+               kMessages, resets, ok ? "ok" : "failed");
+
+    arena.destroy();
+    return ok ? 0 : 1;
+}
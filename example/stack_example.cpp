@@ -0,0 +1,64 @@
+// example/stack_example.cpp
+#include <fmt/core.h>
+#include "../src/LinearAllocator/StackAllocator.hpp"
+
+int main() {
+    fmt::print("Stack Allocator Example\n");
+    fmt::print("=======================\n\n");
+
+    auto allocator_result = alloc::StackAllocator::create(16 * 1024);
+    if (!allocator_result) {
+        fmt::print("Failed to create allocator: {}\n",
+                   static_cast<int>(allocator_result.error()));
+        return 1;
+    }
+
+    auto& stack = allocator_result.value();
+    bool ok = true;
+
+    // Phase 1: nested allocations, freed in reverse order
+    auto vertices = stack.allocate<float>(300);
+    auto indices = stack.allocate<uint32_t>(600);
+    auto scratch = stack.allocate<uint8_t>(100, 64);
+    if (!vertices || !indices || !scratch) {
+        fmt::print("Failed to allocate\n");
+        return 1;
+    }
+    fmt::print("After three allocations: {} bytes used\n", stack.used);
+
+    size_t used_before_scratch = reinterpret_cast<uint8_t*>(indices.value() + 600) - stack.buffer;
+    ok = ok && stack.free(scratch.value()).has_value();
+    fmt::print("After freeing scratch: {} bytes used\n", stack.used);
+    ok = ok && stack.used == used_before_scratch;
+
+    // The new top can grow in place
+    auto grown = stack.resize(indices.value(), 600, 800);
+    fmt::print("Indices grown in place: {}\n", grown && grown.value() == indices.value());
+    ok = ok && grown && grown.value() == indices.value();
+
+#ifndef NDEBUG
+    // Freeing anything but the top is reported in debug builds
+    auto out_of_order = stack.free(vertices.value());
+    fmt::print("Out-of-order free rejected: {}\n",
+               !out_of_order && out_of_order.error() == alloc::AllocError::InvalidFree);
+    ok = ok && !out_of_order && out_of_order.error() == alloc::AllocError::InvalidFree;
+#endif
+
+    ok = ok && stack.free(indices.value()).has_value();
+    ok = ok && stack.free(vertices.value()).has_value();
+    fmt::print("After freeing everything: {} bytes used\n", stack.used);
+    ok = ok && stack.used == 0;
+
+    // Phase 2: the same memory is reused without a reset
+    for (int round = 0; round < 1000; round++) {
+        auto a = stack.allocate<double>(64);
+        auto b = stack.allocate<char>(33, 1);
+        ok = ok && a && b && stack.free(b.value()) && stack.free(a.value());
+    }
+    fmt::print("1000 push/pop rounds, bytes used: {}\n", stack.used);
+    ok = ok && stack.used == 0;
+
+    std::free(stack.buffer);
+    fmt::print("\n{}\n", ok ? "All checks passed" : "Check failed");
+    return ok ? 0 : 1;
+}
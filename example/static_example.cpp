@@ -0,0 +1,87 @@
+// example/static_example.cpp
+#include <fmt/core.h>
+#include <string_view>
+#include "../src/LinearAllocator/StaticLinearAllocator.hpp"
+
+/**
+ * @brief Names packed into one compile-time string table
+ */
+constexpr std::string_view kColorNames[] = {"red", "green", "blue", "cyan", "magenta"};
+
+/**
+ * @brief Compile-time arena holding the packed names
+ */
+using NameArena = alloc::StaticLinearAllocator<64, 1>;
+
+/**
+ * @brief A string table: the arena with the packed, null-terminated names and their offsets
+ */
+struct NameTable {
+    NameArena arena;
+    size_t offsets[std::size(kColorNames)];
+};
+
+/**
+ * @brief Build the string table during constant evaluation
+ */
+constexpr NameTable build_name_table() {
+    NameTable table{};
+    for (size_t i = 0; i < std::size(kColorNames); i++) {
+        std::string_view name = kColorNames[i];
+        uint8_t* bytes = table.arena.allocate_bytes(name.size() + 1).value();
+        for (size_t c = 0; c < name.size(); c++) {
+            bytes[c] = static_cast<uint8_t>(name[c]);
+        }
+        bytes[name.size()] = 0;
+        table.offsets[i] = table.arena.offset_of(bytes);
+    }
+    return table;
+}
+
+constexpr NameTable kNameTable = build_name_table();
+static_assert(kNameTable.arena.used == 28, "five names and their terminators");
+static_assert(kNameTable.arena.storage[kNameTable.offsets[2]] == 'b');
+
+/**
+ * @brief A small particle that lives in a stack arena
+ */
+struct Particle {
+    float x, y, vx, vy;
+};
+
+int main() {
+    fmt::print("Static Linear Allocator Example\n");
+    fmt::print("===============================\n\n");
+
+    // The table was built by the compiler, reading it costs nothing at startup
+    fmt::print("Compile-time string table ({} bytes):\n", kNameTable.arena.used);
+    for (size_t i = 0; i < std::size(kColorNames); i++) {
+        const char* name = reinterpret_cast<const char*>(kNameTable.arena.storage + kNameTable.offsets[i]);
+        fmt::print("  [{}] offset {:>2}: {}\n", i, kNameTable.offsets[i], name);
+    }
+
+    // A stack arena with zeroing and alignment fixed at compile time
+    alloc::StaticLinearAllocator<4096, 64, alloc::ZeroPolicy::OnAllocate> scratch;
+
+    auto particles = scratch.allocate<Particle>(32);
+    if (!particles) {
+        fmt::print("Failed to allocate particles\n");
+        return 1;
+    }
+    for (int i = 0; i < 32; i++) {
+        particles.value()[i] = Particle{float(i), 0.0f, 1.0f, 0.5f};
+    }
+
+    auto line = scratch.allocate_bytes<64>(128);
+    fmt::print("\nStack arena: 32 particles, a cache-line aligned block at offset {}, {} bytes left\n",
+               scratch.offset_of(line.value()), scratch.remaining());
+
+    // The last allocation grows in place
+    auto grown = scratch.resize_bytes<64>(line.value(), 128, 1024);
+    fmt::print("Grown in place: {}, used {} bytes\n", grown.value() == line.value(), scratch.used);
+
+    auto too_big = scratch.allocate_bytes(8192);
+    fmt::print("8KB request: {}\n", too_big ? "succeeded" : "out of memory");
+
+    return too_big ? 1 : 0;
+}
@@ -0,0 +1,70 @@
+// example/stats_example.cpp
+#include <fmt/core.h>
+#include <cstdio>
+#include "../src/LinearAllocator/LinearAllocator.hpp"
+
+#ifndef LINEAR_ALLOCATOR_STATS
+#error "stats_example must be built with LINEAR_ALLOCATOR_STATS"
+#endif
+
+/**
+ * @brief Parse a fake request, making a few allocations from its own call sites
+ */
+void handle_request(alloc::LinearAllocator& allocator, int id) {
+    auto header = allocator.allocate<char>(64);
+    auto body = allocator.allocate<uint64_t>(16 + id % 8);
+    (void)header;
+
+    // Grow the body once, in place because it is the last allocation
+    if (body) {
+        allocator.resize(body.value(), 16 + id % 8, 32);
+    }
+}
+
+int main() {
+    fmt::print("Arena Statistics Example\n");
+    fmt::print("========================\n\n");
+
+    auto allocator_result = alloc::LinearAllocator::create(16 * 1024);
+    if (!allocator_result) {
+        fmt::print("Failed to create allocator: {}\n",
+                   static_cast<int>(allocator_result.error()));
+        return 1;
+    }
+
+    auto& allocator = allocator_result.value();
+
+    for (int frame = 0; frame < 3; frame++) {
+        for (int id = 0; id < 20; id++) {
+            handle_request(allocator, id);
+        }
+
+        // An unaligned byte followed by a cache-line aligned block wastes padding
+        allocator.allocate<char>(1);
+        allocator.allocate_bytes(256, 64);
+        allocator.reset();
+    }
+
+    // Ask for more than the arena holds
+    auto too_big = allocator.allocate<uint8_t>(1024 * 1024);
+
+    // A resize that cannot stay in place copies
+    auto first = allocator.allocate<int>(4);
+    allocator.allocate<int>(1);
+    allocator.resize(first.value(), 4, 8);
+
+    alloc::ArenaStats snapshot = allocator.stats;
+    fmt::print("Allocations:        {}\n", snapshot.allocations);
+    fmt::print("Bytes requested:    {}\n", snapshot.bytes_requested);
+    fmt::print("Padding bytes:      {}\n", snapshot.padding_bytes);
+    fmt::print("High-water mark:    {} of {} bytes\n", snapshot.high_water_mark, allocator.capacity);
+    fmt::print("Resizes in place:   {}\n", snapshot.resizes_in_place);
+    fmt::print("Resizes copied:     {}\n", snapshot.resizes_copied);
+    fmt::print("Out of memory:      {}\n", snapshot.out_of_memory);
+
+    fmt::print("\nJSON export:\n");
+    snapshot.write_json(stdout);
+
+    std::free(allocator.buffer);
+    return too_big ? 1 : 0;
+}
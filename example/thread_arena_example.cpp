@@ -0,0 +1,95 @@
+// example/thread_arena_example.cpp
+#include <fmt/core.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "../src/LinearAllocator/ThreadArena.hpp"
+
+/**
+ * @brief Simulated per-frame work: allocate a batch of particles from the thread's arena
+ *
+ * @param arena The calling thread's arena
+ * @param frame Frame number, used to fill the particles
+ * @return size_t Number of particles allocated, or 0 on failure
+ */
+size_t simulate_frame(alloc::ThreadArena& arena, int frame) {
+    size_t total = 0;
+    for (int batch = 0; batch < 16; batch++) {
+        auto particles_result = arena.allocate<float>(1024);
+        if (!particles_result) {
+            return 0;
+        }
+
+        float* particles = particles_result.value();
+        for (int i = 0; i < 1024; i++) {
+            particles[i] = static_cast<float>(frame * i);
+        }
+        total += 1024;
+    }
+    return total;
+}
+
+int main() {
+    fmt::print("Thread Arena Example\n");
+    fmt::print("====================\n\n");
+
+    // 64 blocks of 64KB shared by every worker thread
+    auto pool_result = alloc::BlockPool::create(64 * 1024, 64);
+    if (!pool_result) {
+        fmt::print("Failed to create block pool: {}\n",
+                   static_cast<int>(pool_result.error()));
+        return 1;
+    }
+
+    auto& pool = pool_result.value();
+    fmt::print("Created pool of {} blocks of {} bytes\n", pool.block_count, pool.block_size);
+
+    constexpr int kThreads = 4;
+    constexpr int kFrames = 5;
+    std::atomic<int> failures{0};
+
+    // Each frame the workers allocate from their own arena, then the frame ends
+    // with a global epoch reset that recycles every block at once
+    std::vector<std::thread> threads;
+    std::atomic<int> frame_done{0};
+    std::atomic<int> frame_start{0};
+    for (int t = 0; t < kThreads; t++) {
+        threads.emplace_back([&] {
+            thread_local alloc::ThreadArena arena(pool);
+            for (int frame = 0; frame < kFrames; frame++) {
+                while (frame_start.load() <= frame) {
+                }
+                if (simulate_frame(arena, frame) == 0) {
+                    failures.fetch_add(1);
+                }
+                frame_done.fetch_add(1);
+            }
+        });
+    }
+
+    for (int frame = 0; frame < kFrames; frame++) {
+        frame_start.store(frame + 1);
+        while (frame_done.load() < kThreads * (frame + 1)) {
+        }
+        pool.epoch_reset();
+        fmt::print("Frame {} done, epoch is now {}\n", frame, pool.epoch.load());
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Thread arenas gave their blocks back on exit, so all of them are free again
+    uint32_t free_blocks = 0;
+    uint32_t index = static_cast<uint32_t>(pool.free_head.load());
+    while (index != alloc::kNoBlock) {
+        free_blocks++;
+        index = pool.links[index].load();
+    }
+    fmt::print("\nFrames with failed allocations: {}\n", failures.load());
+    fmt::print("Free blocks after all threads exited: {} of {}\n", free_blocks, pool.block_count);
+
+    bool ok = failures.load() == 0 && free_blocks == pool.block_count;
+    pool.destroy();
+    return ok ? 0 : 1;
+}
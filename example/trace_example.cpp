@@ -0,0 +1,83 @@
+// example/trace_example.cpp
+#include <fmt/core.h>
+#include <thread>
+#include "../src/LinearAllocator/LinearAllocator.hpp"
+
+#ifndef LINEAR_ALLOCATOR_TRACE
+#error "trace_example must be built with LINEAR_ALLOCATOR_TRACE"
+#endif
+
+/**
+ * @brief A request loop: a growing result, scratch scopes and a reset per request
+ */
+void serve_requests(alloc::LinearAllocator& arena, int requests) {
+    for (int request = 0; request < requests; request++) {
+        uint32_t* ids = arena.allocate<uint32_t>(16).value();
+        size_t count = 16;
+        for (int step = 0; step < 4; step++) {
+            // Growing the last allocation is recorded as an in-place resize
+            ids = arena.resize<uint32_t>(ids, count, count * 2).value();
+            count *= 2;
+        }
+
+        {
+            auto temp = alloc::TempArenaMemory::begin(arena);
+            arena.allocate_bytes(100 + static_cast<size_t>(request % 7) * 50, 1).value();
+            arena.allocate_bytes(512, 64).value();
+        }
+
+        arena.allocate_bytes(24, 8).value();
+        arena.reset();
+    }
+}
+
+int main(int argc, char** argv) {
+    const char* path = argc > 1 ? argv[1] : "arena_trace.bin";
+
+    fmt::print("Arena Trace Example\n");
+    fmt::print("===================\n\n");
+
+    if (!alloc::trace_start(path)) {
+        fmt::print("Failed to open {}\n", path);
+        return 1;
+    }
+
+    auto main_arena = alloc::LinearAllocator::create(64 * 1024, false).value();
+    auto worker_arena = alloc::LinearAllocator::create(16 * 1024, false).value();
+
+    // Every thread records into its own buffer, written out when the thread exits
+    std::thread worker([&] { serve_requests(worker_arena, 300); });
+    serve_requests(main_arena, 200);
+    worker.join();
+
+    // An undersized request is recorded as a failed allocation
+    bool failed = !main_arena.allocate_bytes(128 * 1024, 16);
+    alloc::trace_stop();
+
+    auto events = alloc::read_trace(path);
+    if (!events) {
+        fmt::print("Failed to read {}\n", path);
+        return 1;
+    }
+
+    size_t counts[5] = {};
+    size_t failures = 0;
+    uint32_t threads = 0;
+    for (const alloc::TraceEvent& event : events.value()) {
+        counts[event.kind]++;
+        failures += event.succeeded ? 0 : 1;
+        threads = event.thread + 1 > threads ? event.thread + 1 : threads;
+    }
+    fmt::print("Recorded {} events from {} threads ({} bytes each)\n", events->size(), threads,
+               sizeof(alloc::TraceEvent));
+    fmt::print("Allocate {}, Resize {}, Reset {}, TempBegin {}, TempEnd {}, failed {}\n", counts[0],
+               counts[1], counts[2], counts[3], counts[4], failures);
+    fmt::print("\nReplay it with: arena_replay {} --capacity 8192 --growing 4096 --segregated 4096\n", path);
+
+    bool ok = failed && failures == 1 && threads == 2 && counts[0] == 500 * 4 + 1 &&
+              counts[1] == 500 * 4 && counts[2] == 500 && counts[3] == 500 && counts[4] == 500;
+
+    std::free(main_arena.buffer);
+    std::free(worker_arena.buffer);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,76 @@
+// example/virtual_example.cpp
+#include <fmt/core.h>
+#include <chrono>
+#include <cstdio>
+#include <unistd.h>
+#include "../src/LinearAllocator/VirtualLinearAllocator.hpp"
+
+/**
+ * @brief Read the resident set size of this process
+ *
+ * @return size_t Resident memory in bytes, or 0 if it cannot be read
+ */
+size_t resident_bytes() {
+    FILE* file = std::fopen("/proc/self/statm", "r");
+    if (!file) {
+        return 0;
+    }
+
+    unsigned long total_pages = 0;
+    unsigned long resident_pages = 0;
+    int fields = std::fscanf(file, "%lu %lu", &total_pages, &resident_pages);
+    std::fclose(file);
+
+    if (fields != 2) {
+        return 0;
+    }
+    return resident_pages * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+}
+
+int main() {
+    fmt::print("Virtual Linear Allocator Example\n");
+    fmt::print("================================\n\n");
+
+    size_t rss_start = resident_bytes();
+
+    // Reserve 4GB of address space; nothing is committed yet
+    auto start = std::chrono::steady_clock::now();
+    auto allocator_result = alloc::VirtualLinearAllocator::create(size_t(4) * 1024 * 1024 * 1024);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    if (!allocator_result) {
+        fmt::print("Failed to create allocator: {}\n",
+                   static_cast<int>(allocator_result.error()));
+        return 1;
+    }
+
+    auto& allocator = allocator_result.value();
+    fmt::print("Reserved {} MB in {} us\n", allocator.reserved / (1024 * 1024),
+               std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+    fmt::print("Committed: {} bytes, RSS growth: {} KB\n",
+               allocator.arena.capacity, (resident_bytes() - rss_start) / 1024);
+
+    // Allocate 64MB in 1MB pieces; pages are committed as 'used' advances
+    for (int i = 0; i < 64; i++) {
+        auto chunk_result = allocator.allocate<uint8_t>(1024 * 1024);
+        if (!chunk_result) {
+            fmt::print("Failed to allocate chunk: {}\n",
+                       static_cast<int>(chunk_result.error()));
+            return 1;
+        }
+    }
+    fmt::print("\nAfter allocating 64MB:\n");
+    fmt::print("Committed: {} MB, RSS growth: {} MB\n",
+               allocator.arena.capacity / (1024 * 1024),
+               (resident_bytes() - rss_start) / (1024 * 1024));
+
+    // Reset decommits everything past the retained 1MB
+    allocator.reset();
+    fmt::print("\nAfter reset:\n");
+    fmt::print("Committed: {} KB, RSS growth: {} KB\n",
+               allocator.arena.capacity / 1024, (resident_bytes() - rss_start) / 1024);
+
+    // Release the reservation
+    allocator.destroy();
+
+    return 0;
+}
@@ -0,0 +1,18 @@
+// src/LinearAllocator/AllocError.hpp
+#pragma once
+
+namespace alloc {
+
+/**
+ * @brief Error codes for the linear allocator
+ */
+enum class AllocError {
+    OutOfMemory,      ///< Not enough memory in the allocator
+    InvalidAlignment, ///< Alignment is not a power of 2
+    InvalidFree,      ///< Memory freed out of order, or memory or a reference not owned by the allocator
+    WouldBlock,       ///< Memory is still held by another thread, try again later
+    FileError,        ///< A backing file could not be opened or mapped, or its header is invalid
+    Expired           ///< Memory was reclaimed by a reset before it could be used
+};
+
+} // namespace alloc
@@ -0,0 +1,267 @@
+// src/LinearAllocator/ArenaContainers.hpp
+#pragma once
+
+#include <functional>
+#include <string_view>
+#include <type_traits>
+#include "LinearAllocator.hpp"
+
+namespace alloc {
+
+/**
+ * @brief A growable array that lives in a LinearAllocator
+ *
+ * Growth goes through LinearAllocator::resize, so while the vector is the last
+ * allocation of the arena it grows in place without copying. Elements are never
+ * destroyed; the memory is freed by resetting or rolling back the arena.
+ *
+ * @tparam T Element type, must be trivially copyable (elements may be moved with memcpy)
+ */
+template <typename T>
+struct ArenaVector {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "ArenaVector relocates elements with memcpy");
+
+    LinearAllocator* arena; ///< Allocator the elements live in
+    T* data;                ///< Pointer to the elements
+    size_t size;            ///< Number of elements in use
+    size_t capacity;        ///< Number of elements that fit without growing
+
+    /**
+     * @brief Create an empty vector, nothing is allocated until the first push
+     *
+     * @param allocator The allocator to grow in
+     */
+    explicit ArenaVector(LinearAllocator& allocator)
+        : arena(&allocator), data(nullptr), size(0), capacity(0) {}
+
+    /**
+     * @brief Make room for at least `new_capacity` elements
+     *
+     * @param new_capacity Number of elements to make room for
+     * @return std::expected<void, AllocError> Nothing or an error
+     */
+    std::expected<void, AllocError> reserve(size_t new_capacity);
+
+    /**
+     * @brief Append an element, growing the storage if needed
+     *
+     * @param value The element to append
+     * @return std::expected<void, AllocError> Nothing or an error
+     */
+    std::expected<void, AllocError> push_back(const T& value) {
+        if (size == capacity) {
+            auto grown = reserve(capacity < 8 ? 8 : capacity * 2);
+            if (!grown) {
+                return grown;
+            }
+        }
+        data[size++] = value;
+        return {};
+    }
+
+    /**
+     * @brief Append a range of elements
+     *
+     * @param values Pointer to the elements
+     * @param count Number of elements
+     * @return std::expected<void, AllocError> Nothing or an error
+     */
+    std::expected<void, AllocError> append(const T* values, size_t count);
+
+    void pop_back() { size--; }
+    void clear() { size = 0; }
+    bool empty() const { return size == 0; }
+    T& back() { return data[size - 1]; }
+    T& operator[](size_t index) { return data[index]; }
+    const T& operator[](size_t index) const { return data[index]; }
+    T* begin() { return data; }
+    T* end() { return data + size; }
+    const T* begin() const { return data; }
+    const T* end() const { return data + size; }
+};
+
+/**
+ * @brief A vector made of arena segments of doubling size that never copies
+ *
+ * Segment k holds `kFirstSegment << k` elements. Elements never move once pushed,
+ * so pointers to them stay valid until the arena is reset or rolled back.
+ *
+ * @tparam T Element type, must be trivially destructible (elements are never destroyed)
+ * @tparam kFirstSegment Number of elements in the first segment, a power of 2
+ */
+template <typename T, size_t kFirstSegment = 16>
+struct SegmentedVector {
+    static_assert(std::is_trivially_destructible_v<T>,
+                  "SegmentedVector never runs destructors");
+    static_assert(kFirstSegment != 0 && (kFirstSegment & (kFirstSegment - 1)) == 0,
+                  "kFirstSegment must be a power of 2");
+
+    static constexpr size_t kMaxSegments = 48; ///< Enough segments for any addressable size
+
+    LinearAllocator* arena;       ///< Allocator the segments live in
+    T* segments[kMaxSegments];    ///< Segment k holds kFirstSegment << k elements
+    size_t segment_count;         ///< Number of allocated segments
+    size_t size;                  ///< Number of elements in use
+
+    /**
+     * @brief Create an empty segmented vector
+     *
+     * @param allocator The allocator to take segments from
+     */
+    explicit SegmentedVector(LinearAllocator& allocator)
+        : arena(&allocator), segments{}, segment_count(0), size(0) {}
+
+    /**
+     * @brief Find the segment and offset of an element index
+     */
+    static void locate(size_t index, size_t& segment, size_t& offset);
+
+    /**
+     * @brief Append an element, adding a segment if the last one is full
+     *
+     * @param value The element to append
+     * @return std::expected<T*, AllocError> Stable pointer to the new element or an error
+     */
+    std::expected<T*, AllocError> push_back(const T& value);
+
+    T& operator[](size_t index) {
+        size_t segment;
+        size_t offset;
+        locate(index, segment, offset);
+        return segments[segment][offset];
+    }
+
+    void clear() { size = 0; }
+    bool empty() const { return size == 0; }
+};
+
+/**
+ * @brief Builds a string in an arena, growing in place while it is the last allocation
+ */
+struct StringBuilder {
+    ArenaVector<char> chars; ///< Characters, not null-terminated until c_str()
+
+    /**
+     * @brief Create an empty builder
+     *
+     * @param allocator The allocator to build the string in
+     */
+    explicit StringBuilder(LinearAllocator& allocator) : chars(allocator) {}
+
+    /**
+     * @brief Append text
+     */
+    std::expected<void, AllocError> append(std::string_view text) {
+        return chars.append(text.data(), text.size());
+    }
+
+    /**
+     * @brief Append a single character
+     */
+    std::expected<void, AllocError> append(char c) {
+        return chars.push_back(c);
+    }
+
+    /**
+     * @brief Append the decimal representation of an integer
+     */
+    std::expected<void, AllocError> append_int(long long value);
+
+    /**
+     * @brief Get a null-terminated pointer to the string
+     *
+     * @return std::expected<const char*, AllocError> The string or an error
+     */
+    std::expected<const char*, AllocError> c_str();
+
+    std::string_view view() const { return std::string_view(chars.data, chars.size); }
+    size_t size() const { return chars.size; }
+    void clear() { chars.clear(); }
+};
+
+/**
+ * @brief An open-addressing hash map with linear probing that lives in an arena
+ *
+ * Slots and control bytes are stored in two arena allocations. Growing allocates
+ * a table twice the size and rehashes; the old table is left to the arena.
+ * Erasing uses backward-shift deletion, so there are no tombstones.
+ *
+ * @tparam K Key type, must be trivially copyable
+ * @tparam V Value type, must be trivially copyable
+ * @tparam Hash Hash function
+ * @tparam Eq Key equality
+ */
+template <typename K, typename V, typename Hash = std::hash<K>, typename Eq = std::equal_to<K>>
+struct FlatHashMap {
+    static_assert(std::is_trivially_copyable_v<K> && std::is_trivially_copyable_v<V>,
+                  "FlatHashMap moves slots with memcpy and never runs destructors");
+
+    /**
+     * @brief A key/value pair stored in the table
+     */
+    struct Slot {
+        K key;
+        V value;
+    };
+
+    LinearAllocator* arena; ///< Allocator the table lives in
+    uint8_t* used_slots;    ///< One byte per slot, non-zero when the slot is full
+    Slot* slots;            ///< Slot array
+    size_t capacity;        ///< Number of slots, a power of 2 (0 before the first insert)
+    size_t size;            ///< Number of full slots
+    unsigned shift;         ///< 64 - log2(capacity), for Fibonacci hashing
+    Hash hasher;            ///< Hash function
+    Eq equal;               ///< Key equality
+
+    /**
+     * @brief Create an empty map, nothing is allocated until the first insert
+     *
+     * @param allocator The allocator to put the table in
+     */
+    explicit FlatHashMap(LinearAllocator& allocator)
+        : arena(&allocator), used_slots(nullptr), slots(nullptr),
+          capacity(0), size(0), shift(64), hasher(), equal() {}
+
+    /**
+     * @brief Make room for `count` entries without exceeding the maximum load factor
+     */
+    std::expected<void, AllocError> reserve(size_t count);
+
+    /**
+     * @brief Find the value stored for a key
+     *
+     * @return V* Pointer to the value, or nullptr if the key is missing
+     */
+    V* find(const K& key);
+
+    /**
+     * @brief Insert a key or overwrite its value
+     *
+     * @return std::expected<V*, AllocError> Pointer to the stored value or an error
+     */
+    std::expected<V*, AllocError> insert_or_assign(const K& key, const V& value);
+
+    /**
+     * @brief Remove a key
+     *
+     * @return bool Whether the key was present
+     */
+    bool erase(const K& key);
+
+    /**
+     * @brief Index of the slot a key maps to
+     *
+     * The hash is spread with Fibonacci hashing, since std::hash is the identity
+     * for integers and linear probing needs well mixed bits.
+     */
+    size_t home_slot(const K& key) const {
+        uint64_t hash = static_cast<uint64_t>(hasher(key));
+        return static_cast<size_t>((hash * 0x9E3779B97F4A7C15ull) >> shift);
+    }
+};
+
+} // namespace alloc
+
+// Include template implementation
+#include "ArenaContainers.tpp"
@@ -0,0 +1,224 @@
+// src/LinearAllocator/ArenaContainers.tpp
+#pragma once
+
+#include <bit>
+#include <cstring>
+#include <new>
+
+namespace alloc {
+
+template <typename T>
+inline std::expected<void, AllocError> ArenaVector<T>::reserve(size_t new_capacity) {
+    if (new_capacity <= capacity) {
+        return {};
+    }
+
+    // In place while the vector is the last allocation of the arena, copy otherwise
+    auto grown = arena->resize<T>(data, capacity, new_capacity);
+    if (!grown) {
+        return std::unexpected(grown.error());
+    }
+
+    data = grown.value();
+    capacity = new_capacity;
+    return {};
+}
+
+template <typename T>
+inline std::expected<void, AllocError> ArenaVector<T>::append(const T* values, size_t count) {
+    if (size + count > capacity) {
+        size_t new_capacity = capacity < 8 ? 8 : capacity * 2;
+        if (new_capacity < size + count) {
+            new_capacity = size + count;
+        }
+        auto grown = reserve(new_capacity);
+        if (!grown) {
+            return grown;
+        }
+    }
+
+    if (count > 0) {
+        std::memcpy(data + size, values, count * sizeof(T));
+    }
+    size += count;
+    return {};
+}
+
+template <typename T, size_t kFirstSegment>
+inline void SegmentedVector<T, kFirstSegment>::locate(size_t index, size_t& segment, size_t& offset) {
+    // Segment k starts at element kFirstSegment * (2^k - 1)
+    size_t scaled = index / kFirstSegment + 1;
+    segment = static_cast<size_t>(std::bit_width(scaled)) - 1;
+    offset = index - kFirstSegment * ((size_t(1) << segment) - 1);
+}
+
+template <typename T, size_t kFirstSegment>
+inline std::expected<T*, AllocError> SegmentedVector<T, kFirstSegment>::push_back(const T& value) {
+    size_t segment;
+    size_t offset;
+    locate(size, segment, offset);
+
+    if (segment >= segment_count) {
+        if (segment >= kMaxSegments) {
+            return std::unexpected(AllocError::OutOfMemory);
+        }
+
+        auto new_segment = arena->allocate<T>(kFirstSegment << segment);
+        if (!new_segment) {
+            return std::unexpected(new_segment.error());
+        }
+        segments[segment] = new_segment.value();
+        segment_count = segment + 1;
+    }
+
+    T* slot = &segments[segment][offset];
+    new (slot) T(value);
+    size++;
+    return slot;
+}
+
+inline std::expected<void, AllocError> StringBuilder::append_int(long long value) {
+    char digits[24];
+    size_t length = 0;
+    bool negative = value < 0;
+    unsigned long long magnitude = negative ? 0ull - static_cast<unsigned long long>(value)
+                                            : static_cast<unsigned long long>(value);
+
+    do {
+        digits[sizeof(digits) - 1 - length++] = static_cast<char>('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude != 0);
+
+    if (negative) {
+        digits[sizeof(digits) - 1 - length++] = '-';
+    }
+    return chars.append(digits + sizeof(digits) - length, length);
+}
+
+inline std::expected<const char*, AllocError> StringBuilder::c_str() {
+    // Store the terminator past the end without counting it in the size
+    auto pushed = chars.push_back('\0');
+    if (!pushed) {
+        return std::unexpected(pushed.error());
+    }
+    chars.pop_back();
+    return chars.data;
+}
+
+template <typename K, typename V, typename Hash, typename Eq>
+inline std::expected<void, AllocError> FlatHashMap<K, V, Hash, Eq>::reserve(size_t count) {
+    // Keep the load factor at or below 7/8
+    size_t needed = count + count / 7 + 1;
+    if (needed <= capacity) {
+        return {};
+    }
+
+    size_t new_capacity = std::bit_ceil(needed < 16 ? size_t(16) : needed);
+    auto new_used = arena->allocate<uint8_t>(new_capacity);
+    if (!new_used) {
+        return std::unexpected(new_used.error());
+    }
+    auto new_slots = arena->allocate<Slot>(new_capacity);
+    if (!new_slots) {
+        return std::unexpected(new_slots.error());
+    }
+    std::memset(new_used.value(), 0, new_capacity);
+
+    uint8_t* old_used = used_slots;
+    Slot* old_slots = slots;
+    size_t old_capacity = capacity;
+
+    used_slots = new_used.value();
+    slots = new_slots.value();
+    capacity = new_capacity;
+    shift = 64 - static_cast<unsigned>(std::countr_zero(new_capacity));
+
+    // Rehash into the new table, the old one is left to the arena
+    for (size_t i = 0; i < old_capacity; i++) {
+        if (!old_used[i]) {
+            continue;
+        }
+        size_t index = home_slot(old_slots[i].key);
+        while (used_slots[index]) {
+            index = (index + 1) & (capacity - 1);
+        }
+        used_slots[index] = 1;
+        std::memcpy(&slots[index], &old_slots[i], sizeof(Slot));
+    }
+    return {};
+}
+
+template <typename K, typename V, typename Hash, typename Eq>
+inline V* FlatHashMap<K, V, Hash, Eq>::find(const K& key) {
+    if (size == 0) {
+        return nullptr;
+    }
+
+    size_t index = home_slot(key);
+    while (used_slots[index]) {
+        if (equal(slots[index].key, key)) {
+            return &slots[index].value;
+        }
+        index = (index + 1) & (capacity - 1);
+    }
+    return nullptr;
+}
+
+template <typename K, typename V, typename Hash, typename Eq>
+inline std::expected<V*, AllocError> FlatHashMap<K, V, Hash, Eq>::insert_or_assign(
+    const K& key, const V& value) {
+
+    if (V* existing = find(key)) {
+        *existing = value;
+        return existing;
+    }
+
+    auto reserved = reserve(size + 1);
+    if (!reserved) {
+        return std::unexpected(reserved.error());
+    }
+
+    size_t index = home_slot(key);
+    while (used_slots[index]) {
+        index = (index + 1) & (capacity - 1);
+    }
+
+    used_slots[index] = 1;
+    new (&slots[index]) Slot{key, value};
+    size++;
+    return &slots[index].value;
+}
+
+template <typename K, typename V, typename Hash, typename Eq>
+inline bool FlatHashMap<K, V, Hash, Eq>::erase(const K& key) {
+    if (size == 0) {
+        return false;
+    }
+
+    size_t mask = capacity - 1;
+    size_t hole = home_slot(key);
+    while (used_slots[hole] && !equal(slots[hole].key, key)) {
+        hole = (hole + 1) & mask;
+    }
+    if (!used_slots[hole]) {
+        return false;
+    }
+
+    // Backward-shift deletion: pull later entries of the probe run into the hole
+    // whenever the hole lies between their home slot and their current slot.
+    size_t next = (hole + 1) & mask;
+    while (used_slots[next]) {
+        size_t home = home_slot(slots[next].key);
+        if (((next - home) & mask) >= ((next - hole) & mask)) {
+            std::memcpy(&slots[hole], &slots[next], sizeof(Slot));
+            hole = next;
+        }
+        next = (next + 1) & mask;
+    }
+
+    used_slots[hole] = 0;
+    size--;
+    return true;
+}
+
+} // namespace alloc
@@ -0,0 +1,160 @@
+// src/LinearAllocator/ArenaCoroutine.hpp
+#pragma once
+
+#include <type_traits>
+#include "LinearAllocator.hpp"
+
+namespace alloc {
+
+/**
+ * @brief Base for coroutine promise types whose frames come from a LinearAllocator
+ *
+ * A coroutine whose first parameter is a `LinearAllocator&` (after the object
+ * for member coroutines) gets its frame from that arena; any other coroutine
+ * falls back to the global heap. A frame that still ends at the top of the
+ * arena when it is destroyed gives its space back, so a chain of coroutines
+ * awaited to completion unwinds like a stack and the next request reuses the
+ * memory. Frames freed out of order are reclaimed by the arena's reset() or a
+ * savepoint, which must not happen while a frame is still alive.
+ *
+ * @code
+ * struct promise_type : alloc::ArenaPromiseBase { ... };
+ * Task<int> handle(alloc::LinearAllocator& arena, Request request);
+ * @endcode
+ */
+struct ArenaPromiseBase {
+    /// Bytes in front of every frame recording where it came from, keeps frames max-aligned
+    static constexpr size_t kFrameHeaderBytes = alignof(std::max_align_t);
+    /// Parameters after the arena handled by non-template overloads of operator new
+    static constexpr size_t kMaxFrameArguments = 6;
+
+    /**
+     * @brief Stands for a coroutine parameter that frame allocation ignores
+     */
+    struct FrameArgument {
+        template <typename T>
+        FrameArgument(const T&) {}
+    };
+
+    /**
+     * @brief Stands for the object of a member coroutine, never the arena itself
+     */
+    struct FrameObject {
+        template <typename T>
+            requires(!std::is_same_v<T, LinearAllocator>)
+        FrameObject(const T&) {}
+    };
+
+    /**
+     * @brief Frame of a coroutine taking the arena as its first parameter
+     *
+     * Coroutines with up to kMaxFrameArguments further parameters use these
+     * non-template overloads, so the allocation pairs cleanly with the usual
+     * operator delete the frame is freed with (a member template operator new
+     * trips GCC's -Wmismatched-new-delete).
+     *
+     * @throws std::bad_alloc when the arena is out of memory
+     */
+    static void* operator new(size_t size, LinearAllocator& arena) {
+        return allocate_frame(size, &arena);
+    }
+    static void* operator new(size_t size, LinearAllocator& arena, FrameArgument) {
+        return allocate_frame(size, &arena);
+    }
+    static void* operator new(size_t size, LinearAllocator& arena, FrameArgument, FrameArgument) {
+        return allocate_frame(size, &arena);
+    }
+    static void* operator new(size_t size, LinearAllocator& arena, FrameArgument, FrameArgument,
+                              FrameArgument) {
+        return allocate_frame(size, &arena);
+    }
+    static void* operator new(size_t size, LinearAllocator& arena, FrameArgument, FrameArgument,
+                              FrameArgument, FrameArgument) {
+        return allocate_frame(size, &arena);
+    }
+    static void* operator new(size_t size, LinearAllocator& arena, FrameArgument, FrameArgument,
+                              FrameArgument, FrameArgument, FrameArgument) {
+        return allocate_frame(size, &arena);
+    }
+    static void* operator new(size_t size, LinearAllocator& arena, FrameArgument, FrameArgument,
+                              FrameArgument, FrameArgument, FrameArgument, FrameArgument) {
+        return allocate_frame(size, &arena);
+    }
+
+    /**
+     * @brief Frame of a member coroutine taking the arena as its first parameter
+     *
+     * @throws std::bad_alloc when the arena is out of memory
+     */
+    static void* operator new(size_t size, FrameObject, LinearAllocator& arena) {
+        return allocate_frame(size, &arena);
+    }
+    static void* operator new(size_t size, FrameObject, LinearAllocator& arena, FrameArgument) {
+        return allocate_frame(size, &arena);
+    }
+    static void* operator new(size_t size, FrameObject, LinearAllocator& arena, FrameArgument,
+                              FrameArgument) {
+        return allocate_frame(size, &arena);
+    }
+    static void* operator new(size_t size, FrameObject, LinearAllocator& arena, FrameArgument,
+                              FrameArgument, FrameArgument) {
+        return allocate_frame(size, &arena);
+    }
+    static void* operator new(size_t size, FrameObject, LinearAllocator& arena, FrameArgument,
+                              FrameArgument, FrameArgument, FrameArgument) {
+        return allocate_frame(size, &arena);
+    }
+    static void* operator new(size_t size, FrameObject, LinearAllocator& arena, FrameArgument,
+                              FrameArgument, FrameArgument, FrameArgument, FrameArgument) {
+        return allocate_frame(size, &arena);
+    }
+    static void* operator new(size_t size, FrameObject, LinearAllocator& arena, FrameArgument,
+                              FrameArgument, FrameArgument, FrameArgument, FrameArgument,
+                              FrameArgument) {
+        return allocate_frame(size, &arena);
+    }
+
+    /**
+     * @brief Frames of coroutines with more than kMaxFrameArguments further parameters
+     *
+     * Still taken from the arena, but GCC may report -Wmismatched-new-delete for them.
+     */
+    template <typename... Args>
+        requires(sizeof...(Args) > kMaxFrameArguments)
+    static void* operator new(size_t size, LinearAllocator& arena, Args&...) {
+        return allocate_frame(size, &arena);
+    }
+    template <typename Self, typename... Args>
+        requires(sizeof...(Args) > kMaxFrameArguments &&
+                 !std::is_same_v<std::remove_cv_t<Self>, LinearAllocator>)
+    static void* operator new(size_t size, Self&, LinearAllocator& arena, Args&...) {
+        return allocate_frame(size, &arena);
+    }
+
+    /**
+     * @brief Frame of a coroutine without an arena, from the global heap
+     */
+    static void* operator new(size_t size) {
+        return allocate_frame(size, nullptr);
+    }
+
+    /**
+     * @brief Give a frame back to the heap, or to its arena if it is the last allocation
+     */
+    static void operator delete(void* frame, size_t size) noexcept;
+
+    /**
+     * @brief Allocate a frame and its header from the arena, or the heap when `arena` is nullptr
+     */
+    static void* allocate_frame(size_t size, LinearAllocator* arena);
+
+    /**
+     * @brief Header plus frame, rounded so the end of a frame is where the next one starts
+     */
+    static size_t frame_block_size(size_t size);
+};
+
+} // namespace alloc
+
+// Include template implementation
+#include "ArenaCoroutine.tpp"
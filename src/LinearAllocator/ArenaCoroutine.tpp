@@ -0,0 +1,63 @@
+// src/LinearAllocator/ArenaCoroutine.tpp
+#pragma once
+
+#include <cstring>
+#include <new>
+
+namespace alloc {
+
+inline size_t ArenaPromiseBase::frame_block_size(size_t size) {
+    return kFrameHeaderBytes + (size + kFrameHeaderBytes - 1) / kFrameHeaderBytes * kFrameHeaderBytes;
+}
+
+inline void* ArenaPromiseBase::allocate_frame(size_t size, LinearAllocator* arena) {
+    void* block = nullptr;
+    if (arena) {
+        auto result = arena->allocate_bytes(frame_block_size(size), kFrameHeaderBytes);
+        if (!result) {
+            throw std::bad_alloc();
+        }
+        block = result.value();
+    } else {
+        block = ::operator new(frame_block_size(size));
+    }
+
+    // The header remembers the arena, so delete knows where the frame came from
+    *static_cast<LinearAllocator**>(block) = arena;
+    return static_cast<uint8_t*>(block) + kFrameHeaderBytes;
+}
+
+inline void ArenaPromiseBase::operator delete(void* frame, size_t size) noexcept {
+    uint8_t* block = static_cast<uint8_t*>(frame) - kFrameHeaderBytes;
+    LinearAllocator* arena = *reinterpret_cast<LinearAllocator**>(block);
+    if (!arena) {
+        ::operator delete(block, frame_block_size(size));
+        return;
+    }
+
+    // Frames die in reverse order of creation, so the one on top of the arena is
+    // given back even when it is no longer the most recent allocation
+    size_t offset = static_cast<size_t>(block - arena->buffer);
+    if (offset + frame_block_size(size) != arena->used) {
+        return;
+    }
+
+#ifdef LINEAR_ALLOCATOR_DEBUG
+    // Give back the guard zone in front of the frame too, or every frame would leak one
+    GuardRecord record;
+    unpoison_memory(block - sizeof(record), sizeof(record));
+    std::memcpy(&record, block - sizeof(record), sizeof(record));
+    poison_memory(block - sizeof(record), sizeof(record));
+    offset = record.gap_begin;
+    arena->debug_release(offset);
+#endif
+#ifdef LINEAR_ALLOCATOR_TRACE
+    trace_record(TraceKind::Resize, arena, 0, frame_block_size(size), kFrameHeaderBytes, true);
+#endif
+    arena->used = offset;
+    if (arena->prev_used > offset) {
+        arena->prev_used = offset;
+    }
+}
+
+} // namespace alloc
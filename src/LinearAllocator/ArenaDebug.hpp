@@ -0,0 +1,115 @@
+// src/LinearAllocator/ArenaDebug.hpp
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * Debug mode is opt-in: define LINEAR_ALLOCATOR_DEBUG (or configure CMake with
+ * -DLINEAR_ALLOCATOR_DEBUG=ON) to put a guard zone in front of every
+ * LinearAllocator allocation, fill memory with patterns and check the guards when
+ * memory is given back. Without it every hook is compiled out and the layout of
+ * allocations is unchanged.
+ *
+ * When the build also uses AddressSanitizer, guard zones and memory given back by
+ * reset(), TempArenaMemory::end() or a shrinking resize are poisoned, so touching
+ * them is reported at the faulty access.
+ */
+#ifdef LINEAR_ALLOCATOR_DEBUG
+
+#ifndef LINEAR_ALLOCATOR_REDZONE
+#define LINEAR_ALLOCATOR_REDZONE 32 ///< Minimum guard zone in front of every allocation, at least 32
+#endif
+
+#ifndef LINEAR_ALLOCATOR_DEBUG_FILL
+#define LINEAR_ALLOCATOR_DEBUG_FILL 1 ///< Fill unzeroed allocations and freed memory with patterns
+#endif
+
+#if defined(__SANITIZE_ADDRESS__)
+#define LINEAR_ALLOCATOR_ASAN 1
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define LINEAR_ALLOCATOR_ASAN 1
+#endif
+#endif
+
+#endif // LINEAR_ALLOCATOR_DEBUG
+
+namespace alloc {
+
+/**
+ * @brief Bytes of guard zone put in front of every allocation, 0 outside debug mode
+ */
+#ifdef LINEAR_ALLOCATOR_DEBUG
+inline constexpr size_t kRedzoneBytes = LINEAR_ALLOCATOR_REDZONE;
+static_assert(kRedzoneBytes >= 32, "The guard zone must hold a GuardRecord and some pattern bytes");
+#else
+inline constexpr size_t kRedzoneBytes = 0;
+#endif
+
+inline constexpr uint8_t kGuardPattern = 0xFD;     ///< Fills guard zones
+inline constexpr uint8_t kAllocatedPattern = 0xCD; ///< Fills allocations that are not zeroed
+inline constexpr uint8_t kFreedPattern = 0xDD;     ///< Fills memory given back to the arena
+inline constexpr size_t kNoGuard = SIZE_MAX;       ///< End of the guard chain
+
+/**
+ * @brief Stored in the last bytes of every guard zone, links the zones of an arena newest first
+ */
+struct GuardRecord {
+    size_t previous;  ///< Offset of the previous record, or kNoGuard
+    size_t gap_begin; ///< Offset where this guard zone starts
+};
+
+/**
+ * @brief Mark memory as unaddressable for AddressSanitizer, a no-op without it
+ */
+void poison_memory(const void* address, size_t size);
+
+/**
+ * @brief Mark memory as addressable again for AddressSanitizer, a no-op without it
+ */
+void unpoison_memory(const void* address, size_t size);
+
+/**
+ * @brief Whether AddressSanitizer reports accesses to this byte, always false without it
+ */
+bool memory_is_poisoned(const void* address);
+
+/**
+ * @brief Fill [gap_begin, start) with the guard pattern, record it and poison it
+ *
+ * @param buffer Start of the arena
+ * @param gap_begin Offset where the guard zone starts
+ * @param start Offset of the allocation the zone protects
+ * @param last_guard Head of the guard chain, updated to the new record
+ */
+void write_guard(uint8_t* buffer, size_t gap_begin, size_t start, size_t& last_guard);
+
+/**
+ * @brief Walk the guard chain and check every zone still holds the pattern
+ *
+ * @param buffer Start of the arena
+ * @param last_guard Head of the guard chain
+ * @param bad_offset Receives the offset of the first damaged zone
+ * @return bool Whether every guard zone is intact
+ */
+bool check_guards(uint8_t* buffer, size_t last_guard, size_t& bad_offset);
+
+/**
+ * @brief Unlink the guard records at or past `from`, which is being given back
+ *
+ * @param buffer Start of the arena
+ * @param last_guard Head of the guard chain, updated to the newest record below `from`
+ * @param from Offset the arena rolls back to
+ */
+void drop_guards(uint8_t* buffer, size_t& last_guard, size_t from);
+
+/**
+ * @brief Print where a guard zone was overwritten and abort
+ */
+[[noreturn]] void report_guard_corruption(const void* buffer, size_t offset);
+
+} // namespace alloc
+
+// Include template implementation
+#include "ArenaDebug.tpp"
@@ -0,0 +1,102 @@
+// src/LinearAllocator/ArenaDebug.tpp
+#pragma once
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef LINEAR_ALLOCATOR_ASAN
+#include <sanitizer/asan_interface.h>
+#endif
+
+namespace alloc {
+
+inline void poison_memory(const void* address, size_t size) {
+#ifdef LINEAR_ALLOCATOR_ASAN
+    ASAN_POISON_MEMORY_REGION(address, size);
+#else
+    (void)address;
+    (void)size;
+#endif
+}
+
+inline void unpoison_memory(const void* address, size_t size) {
+#ifdef LINEAR_ALLOCATOR_ASAN
+    ASAN_UNPOISON_MEMORY_REGION(address, size);
+#else
+    (void)address;
+    (void)size;
+#endif
+}
+
+inline bool memory_is_poisoned(const void* address) {
+#ifdef LINEAR_ALLOCATOR_ASAN
+    return __asan_address_is_poisoned(address) != 0;
+#else
+    (void)address;
+    return false;
+#endif
+}
+
+inline void write_guard(uint8_t* buffer, size_t gap_begin, size_t start, size_t& last_guard) {
+    size_t record_offset = start - sizeof(GuardRecord);
+    GuardRecord record{last_guard, gap_begin};
+
+    unpoison_memory(buffer + gap_begin, start - gap_begin);
+    std::memset(buffer + gap_begin, kGuardPattern, record_offset - gap_begin);
+    std::memcpy(buffer + record_offset, &record, sizeof(record));
+    poison_memory(buffer + gap_begin, start - gap_begin);
+
+    last_guard = record_offset;
+}
+
+inline bool check_guards(uint8_t* buffer, size_t last_guard, size_t& bad_offset) {
+    size_t record_offset = last_guard;
+    while (record_offset != kNoGuard) {
+        // Guard zones are poisoned, open each one just long enough to read it
+        GuardRecord record;
+        unpoison_memory(buffer + record_offset, sizeof(record));
+        std::memcpy(&record, buffer + record_offset, sizeof(record));
+        poison_memory(buffer + record_offset, sizeof(record));
+
+        // A damaged record is caught by its links before they are followed
+        if (record.gap_begin > record_offset ||
+            record_offset - record.gap_begin + sizeof(record) < kRedzoneBytes ||
+            (record.previous != kNoGuard && record.previous >= record.gap_begin)) {
+            bad_offset = record_offset;
+            return false;
+        }
+
+        size_t length = record_offset - record.gap_begin;
+        unpoison_memory(buffer + record.gap_begin, length);
+        for (size_t i = 0; i < length; i++) {
+            if (buffer[record.gap_begin + i] != kGuardPattern) {
+                poison_memory(buffer + record.gap_begin, length);
+                bad_offset = record.gap_begin + i;
+                return false;
+            }
+        }
+        poison_memory(buffer + record.gap_begin, length);
+
+        record_offset = record.previous;
+    }
+    return true;
+}
+
+inline void drop_guards(uint8_t* buffer, size_t& last_guard, size_t from) {
+    while (last_guard != kNoGuard && last_guard >= from) {
+        GuardRecord record;
+        unpoison_memory(buffer + last_guard, sizeof(record));
+        std::memcpy(&record, buffer + last_guard, sizeof(record));
+        poison_memory(buffer + last_guard, sizeof(record));
+        last_guard = record.previous;
+    }
+}
+
+inline void report_guard_corruption(const void* buffer, size_t offset) {
+    std::fprintf(stderr, "LinearAllocator: guard zone overwritten at offset %zu of arena %p\n",
+                 offset, buffer);
+    std::abort();
+}
+
+} // namespace alloc
@@ -0,0 +1,90 @@
+// src/LinearAllocator/ArenaPlacement.hpp
+#pragma once
+
+#include "LinearAllocator.hpp"
+
+namespace alloc {
+
+/**
+ * @brief Huge page policy for mapped arena memory
+ */
+enum class HugePages {
+    Default,     ///< Leave the system's transparent huge page policy alone
+    Disabled,    ///< Opt out of transparent huge pages (MADV_NOHUGEPAGE)
+    Transparent, ///< Ask for transparent huge pages (MADV_HUGEPAGE)
+    Explicit     ///< Use MAP_HUGETLB pages, falling back to Transparent if none are available
+};
+
+/**
+ * @brief Where and how the backing memory of an arena is placed
+ */
+struct PlacementOptions {
+    HugePages huge_pages = HugePages::Default; ///< Huge page policy
+    int numa_node = -1;    ///< NUMA node to bind the memory to with mbind, or -1 for no binding
+    bool prefault = false; ///< Touch every page at creation (first-touch on the calling thread's node)
+};
+
+/**
+ * @brief A memory region mapped according to PlacementOptions
+ */
+struct MappedRegion {
+    uint8_t* base;    ///< Start of the mapping
+    size_t size;      ///< Length of the mapping in bytes
+    bool huge_tlb;    ///< Whether the mapping uses explicit MAP_HUGETLB pages
+    bool numa_bound;  ///< Whether the mbind to the requested node succeeded
+};
+
+/**
+ * @brief Size of the system's default huge page
+ *
+ * @return size_t Huge page size in bytes (2MB if it cannot be determined)
+ */
+size_t huge_page_size();
+
+/**
+ * @brief Map anonymous memory placed according to the options
+ *
+ * Explicit huge pages are tried first when requested; if the mapping fails the
+ * region is mapped with normal pages and MADV_HUGEPAGE, at a huge page aligned
+ * address so transparent huge pages can back all of it. When binding to the NUMA
+ * node fails, the memory is left to first-touch placement and `numa_bound` is false.
+ * Memory mapped with `PROT_NONE` is never prefaulted and never uses MAP_HUGETLB,
+ * since explicit huge pages cannot be committed incrementally.
+ *
+ * @param size_in_bytes Requested size, rounded up to the page (or huge page) size
+ * @param options Placement options
+ * @param writable Map the region read/write (true) or reserve it with PROT_NONE (false)
+ * @return std::expected<MappedRegion, AllocError> The mapped region or an error
+ */
+std::expected<MappedRegion, AllocError> map_region(size_t size_in_bytes,
+                                                   const PlacementOptions& options,
+                                                   bool writable = true);
+
+/**
+ * @brief Unmap a region created by map_region
+ */
+void unmap_region(const MappedRegion& region);
+
+/**
+ * @brief Create a Linear Allocator over mapped memory placed according to the options
+ *
+ * The mapping starts zeroed, so no memset is done. The capacity is the mapped
+ * length, which can be larger than requested. Free it with destroy_mapped_arena.
+ *
+ * @param size_in_bytes The total size of the allocator in bytes
+ * @param options Huge page and NUMA placement options
+ * @param zero_memory Whether to zero memory on allocation
+ * @return std::expected<LinearAllocator, AllocError> A new allocator or an error
+ */
+std::expected<LinearAllocator, AllocError> create_mapped_arena(
+    size_t size_in_bytes, const PlacementOptions& options, bool zero_memory = true);
+
+/**
+ * @brief Unmap the memory of an allocator created by create_mapped_arena
+ */
+void destroy_mapped_arena(LinearAllocator& allocator);
+
+} // namespace alloc
+
+// Include template implementation
+#include "ArenaPlacement.tpp"
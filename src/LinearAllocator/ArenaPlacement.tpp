@@ -0,0 +1,173 @@
+// src/LinearAllocator/ArenaPlacement.tpp
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace alloc {
+
+/**
+ * @brief Round a size up to a multiple of a power-of-two granularity
+ */
+inline size_t round_up_to(size_t size, size_t granularity) {
+    return (size + granularity - 1) & ~(granularity - 1);
+}
+
+inline size_t huge_page_size() {
+    static const size_t cached = [] {
+        size_t size = size_t(2) * 1024 * 1024;
+        FILE* file = std::fopen("/proc/meminfo", "r");
+        if (!file) {
+            return size;
+        }
+
+        char line[128];
+        while (std::fgets(line, sizeof(line), file)) {
+            unsigned long kilobytes = 0;
+            if (std::sscanf(line, "Hugepagesize: %lu kB", &kilobytes) == 1 && kilobytes > 0) {
+                size = static_cast<size_t>(kilobytes) * 1024;
+                break;
+            }
+        }
+        std::fclose(file);
+        return size;
+    }();
+    return cached;
+}
+
+/**
+ * @brief Bind a range to a single NUMA node with the mbind system call
+ *
+ * @return bool Whether the kernel accepted the policy
+ */
+inline bool bind_to_numa_node(uint8_t* start, size_t length, int node) {
+#if defined(__linux__) && defined(SYS_mbind)
+    constexpr int kMpolBind = 2;
+    constexpr size_t kBitsPerWord = sizeof(unsigned long) * 8;
+    if (node < 0 || static_cast<size_t>(node) >= kBitsPerWord * 16) {
+        return false;
+    }
+
+    unsigned long mask[16] = {};
+    mask[node / kBitsPerWord] = 1UL << (node % kBitsPerWord);
+    return syscall(SYS_mbind, start, length, kMpolBind, mask, kBitsPerWord * 16 + 1, 0) == 0;
+#else
+    (void)start;
+    (void)length;
+    (void)node;
+    return false;
+#endif
+}
+
+inline std::expected<MappedRegion, AllocError> map_region(size_t size_in_bytes,
+                                                          const PlacementOptions& options,
+                                                          bool writable) {
+    if (size_in_bytes == 0) {
+        return std::unexpected(AllocError::OutOfMemory);
+    }
+
+    int prot = writable ? PROT_READ | PROT_WRITE : PROT_NONE;
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS | (writable ? 0 : MAP_NORESERVE);
+    size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    MappedRegion region{nullptr, 0, false, false};
+
+#if defined(MAP_HUGETLB)
+    if (options.huge_pages == HugePages::Explicit && writable) {
+        size_t length = round_up_to(size_in_bytes, huge_page_size());
+        void* mem = mmap(nullptr, length, prot, flags | MAP_HUGETLB, -1, 0);
+        if (mem != MAP_FAILED) {
+            region = MappedRegion{static_cast<uint8_t*>(mem), length, true, false};
+        }
+    }
+#endif
+
+    if (!region.base) {
+        // Transparent huge pages can only cover the whole region if both its base and
+        // its length are huge page aligned. mmap only guarantees page alignment, so
+        // map one huge page extra and trim the misaligned head and tail.
+        size_t granularity = options.huge_pages == HugePages::Transparent ||
+                                     options.huge_pages == HugePages::Explicit
+                                 ? huge_page_size()
+                                 : page_size;
+        if (size_in_bytes > SIZE_MAX - 2 * granularity) {
+            return std::unexpected(AllocError::OutOfMemory);
+        }
+        size_t length = round_up_to(size_in_bytes, granularity);
+        size_t slack = granularity > page_size ? granularity : 0;
+        void* mem = mmap(nullptr, length + slack, prot, flags, -1, 0);
+        if (mem == MAP_FAILED) {
+            return std::unexpected(AllocError::OutOfMemory);
+        }
+
+        uint8_t* mapped = static_cast<uint8_t*>(mem);
+        uint8_t* base = mapped;
+        if (slack) {
+            uintptr_t addr = reinterpret_cast<uintptr_t>(mapped);
+            base = mapped + (round_up_to(addr, granularity) - addr);
+            if (base > mapped) {
+                munmap(mapped, static_cast<size_t>(base - mapped));
+            }
+            size_t tail = static_cast<size_t>(mapped + length + slack - (base + length));
+            if (tail) {
+                munmap(base + length, tail);
+            }
+        }
+        region = MappedRegion{base, length, false, false};
+
+#if defined(MADV_HUGEPAGE) && defined(MADV_NOHUGEPAGE)
+        if (options.huge_pages == HugePages::Transparent ||
+            options.huge_pages == HugePages::Explicit) {
+            madvise(region.base, region.size, MADV_HUGEPAGE);
+        } else if (options.huge_pages == HugePages::Disabled) {
+            madvise(region.base, region.size, MADV_NOHUGEPAGE);
+        }
+#endif
+    }
+
+    // The policy must be in place before the first touch to take effect
+    if (options.numa_node >= 0) {
+        region.numa_bound = bind_to_numa_node(region.base, region.size, options.numa_node);
+    }
+
+    if (options.prefault && writable) {
+        size_t step = region.huge_tlb ? huge_page_size() : page_size;
+        for (size_t offset = 0; offset < region.size; offset += step) {
+            region.base[offset] = 0;
+        }
+    }
+
+    return region;
+}
+
+inline void unmap_region(const MappedRegion& region) {
+    if (region.base) {
+        munmap(region.base, region.size);
+    }
+}
+
+inline std::expected<LinearAllocator, AllocError> create_mapped_arena(
+    size_t size_in_bytes, const PlacementOptions& options, bool zero_memory) {
+
+    auto region = map_region(size_in_bytes, options, true);
+    if (!region) {
+        return std::unexpected(region.error());
+    }
+
+    // Anonymous mappings start zeroed, so there is no upfront memset
+    LinearAllocator result(region->base, region->size, zero_memory);
+    result.known_zero_offset = 0;
+    return result;
+}
+
+inline void destroy_mapped_arena(LinearAllocator& allocator) {
+    allocator.run_destructors(nullptr);
+    allocator.unpoison();
+    unmap_region(MappedRegion{allocator.buffer, allocator.capacity, false, false});
+    allocator = LinearAllocator(nullptr, 0, allocator.zero_on_alloc);
+}
+
+} // namespace alloc
@@ -0,0 +1,101 @@
+// src/LinearAllocator/ArenaResource.hpp
+#pragma once
+
+#include <memory_resource>
+#include "LinearAllocator.hpp"
+
+namespace alloc {
+
+/**
+ * @brief Give back the most recent allocation of an arena
+ *
+ * If `ptr` is the last allocation and nothing was allocated after it, `used`
+ * moves back to its start so the space is reused by the next allocation.
+ *
+ * @param arena The allocator the memory came from
+ * @param ptr Pointer returned by the allocator
+ * @param size_in_bytes Size of the allocation in bytes
+ * @return bool Whether the space was reclaimed
+ */
+bool release_if_last(LinearAllocator& arena, void* ptr, size_t size_in_bytes);
+
+/**
+ * @brief A std::pmr::memory_resource that allocates from a LinearAllocator
+ *
+ * Lets `std::pmr` containers (vector, string, unordered_map, ...) live in the
+ * arena. Allocation failures throw `std::bad_alloc` as the interface requires.
+ * Deallocating the most recent block reclaims its space; every other
+ * deallocation is a no-op until the arena is reset.
+ *
+ * Standard containers always allocate a new buffer before releasing the old one
+ * when they grow, so they cannot use LinearAllocator::resize; the arena-native
+ * containers grow in place instead.
+ */
+struct ArenaMemoryResource : std::pmr::memory_resource {
+    LinearAllocator* arena; ///< Allocator the memory comes from
+
+    /**
+     * @brief Create a memory resource backed by an allocator
+     *
+     * @param allocator The allocator to draw memory from, must outlive the resource
+     */
+    explicit ArenaMemoryResource(LinearAllocator& allocator) : arena(&allocator) {}
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* ptr, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+};
+
+/**
+ * @brief A stateful STL allocator that allocates from a LinearAllocator
+ *
+ * Usable with any allocator-aware container, e.g.
+ * `std::vector<int, alloc::ArenaAllocator<int>> values(alloc::ArenaAllocator<int>(arena));`.
+ * Two ArenaAllocators compare equal when they use the same arena.
+ *
+ * @tparam T The value type
+ */
+template <typename T>
+struct ArenaAllocator {
+    using value_type = T;
+
+    LinearAllocator* arena; ///< Allocator the memory comes from
+
+    /**
+     * @brief Create an allocator backed by an arena
+     *
+     * @param allocator The allocator to draw memory from, must outlive every container using it
+     */
+    ArenaAllocator(LinearAllocator& allocator) noexcept : arena(&allocator) {}
+
+    /**
+     * @brief Rebind from an allocator of another value type
+     */
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena(other.arena) {}
+
+    /**
+     * @brief Allocate storage for `count` objects
+     *
+     * @throws std::bad_alloc when the arena is out of memory
+     */
+    T* allocate(size_t count);
+
+    /**
+     * @brief Release storage, reclaiming it if it was the last allocation
+     */
+    void deallocate(T* ptr, size_t count) noexcept {
+        release_if_last(*arena, ptr, count * sizeof(T));
+    }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& other) const noexcept {
+        return arena == other.arena;
+    }
+};
+
+} // namespace alloc
+
+// Include template implementation
+#include "ArenaResource.tpp"
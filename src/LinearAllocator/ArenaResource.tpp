@@ -0,0 +1,55 @@
+// src/LinearAllocator/ArenaResource.tpp
+#pragma once
+
+#include <cstdint>
+#include <new>
+
+namespace alloc {
+
+inline bool release_if_last(LinearAllocator& arena, void* ptr, size_t size_in_bytes) {
+    if (ptr != arena.buffer + arena.prev_used || arena.prev_used + size_in_bytes != arena.used) {
+        return false;
+    }
+
+#ifdef LINEAR_ALLOCATOR_DEBUG
+    arena.debug_release(arena.prev_used);
+#endif
+#ifdef LINEAR_ALLOCATOR_TRACE
+    trace_record(TraceKind::Resize, &arena, 0, size_in_bytes, 1, true);
+#endif
+    arena.used = arena.prev_used;
+    return true;
+}
+
+inline void* ArenaMemoryResource::do_allocate(size_t bytes, size_t alignment) {
+    auto result = arena->allocate_bytes(bytes, alignment);
+    if (!result) {
+        throw std::bad_alloc();
+    }
+    return result.value();
+}
+
+inline void ArenaMemoryResource::do_deallocate(void* ptr, size_t bytes, size_t alignment) {
+    (void)alignment;
+    release_if_last(*arena, ptr, bytes);
+}
+
+inline bool ArenaMemoryResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    auto* other_arena = dynamic_cast<const ArenaMemoryResource*>(&other);
+    return other_arena && other_arena->arena == arena;
+}
+
+template <typename T>
+inline T* ArenaAllocator<T>::allocate(size_t count) {
+    if (count > SIZE_MAX / sizeof(T)) {
+        throw std::bad_array_new_length();
+    }
+
+    auto result = arena->allocate_bytes(count * sizeof(T), alignof(T));
+    if (!result) {
+        throw std::bad_alloc();
+    }
+    return static_cast<T*>(result.value());
+}
+
+} // namespace alloc
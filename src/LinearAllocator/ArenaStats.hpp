@@ -0,0 +1,98 @@
+// src/LinearAllocator/ArenaStats.hpp
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <source_location>
+
+/**
+ * Statistics are opt-in: define LINEAR_ALLOCATOR_STATS (or configure CMake with
+ * -DLINEAR_ALLOCATOR_STATS=ON) to add an ArenaStats member to LinearAllocator.
+ * Without it every hook is compiled out. Debug builds with statistics also
+ * attribute allocations to call sites.
+ */
+#if defined(LINEAR_ALLOCATOR_STATS) && !defined(NDEBUG)
+#define LINEAR_ALLOCATOR_CALLSITES 1
+#endif
+
+/**
+ * Extra trailing parameter of the allocation functions that receives the caller's
+ * location when call sites are tracked, and nothing otherwise.
+ */
+#ifdef LINEAR_ALLOCATOR_CALLSITES
+#define LINEAR_ALLOCATOR_CALLSITE_DECL , std::source_location callsite = std::source_location::current()
+#define LINEAR_ALLOCATOR_CALLSITE_PARAM , std::source_location callsite
+#define LINEAR_ALLOCATOR_CALLSITE_ARG , callsite
+#else
+#define LINEAR_ALLOCATOR_CALLSITE_DECL
+#define LINEAR_ALLOCATOR_CALLSITE_PARAM
+#define LINEAR_ALLOCATOR_CALLSITE_ARG
+#endif
+
+namespace alloc {
+
+/**
+ * @brief Allocation counters attributed to one source location
+ */
+struct CallSiteStats {
+    const char* file;     ///< Source file of the call, nullptr for an empty entry
+    const char* function; ///< Enclosing function of the call
+    uint32_t line;        ///< Line of the call
+    uint64_t allocations; ///< Number of allocations made from here
+    uint64_t bytes;       ///< Bytes requested from here
+};
+
+/**
+ * @brief Allocation statistics of one arena
+ *
+ * Plain counters updated by the allocator hooks; copying the struct is the
+ * snapshot. All offsets are relative to the arena's current buffer.
+ */
+struct ArenaStats {
+    static constexpr size_t kHistogramBuckets = 32; ///< Size buckets, one per power of 2
+    static constexpr size_t kMaxCallSites = 32;     ///< Distinct call sites tracked
+
+    uint64_t allocations;       ///< Successful allocations
+    uint64_t bytes_requested;   ///< Bytes requested by successful allocations
+    uint64_t padding_bytes;     ///< Bytes skipped to satisfy alignment
+    uint64_t high_water_mark;   ///< Largest `used` offset ever reached
+    uint64_t resizes_in_place;  ///< resize() calls that grew or shrank in place
+    uint64_t resizes_copied;    ///< resize() calls that fell back to allocate and copy
+    uint64_t out_of_memory;     ///< Allocations and resizes that failed for lack of space
+    uint64_t size_histogram[kHistogramBuckets]; ///< Bucket i counts sizes in [2^(i-1), 2^i)
+    CallSiteStats call_sites[kMaxCallSites];    ///< Per call site counters (debug builds)
+    uint64_t untracked_call_sites; ///< Allocations from call sites that did not fit the table
+
+    /**
+     * @brief Record a successful allocation
+     *
+     * @param size_in_bytes Requested size
+     * @param padding Bytes skipped for alignment
+     * @param used_after Arena offset after the allocation
+     */
+    void record_allocation(size_t size_in_bytes, size_t padding, size_t used_after);
+
+    /**
+     * @brief Attribute an allocation to the location it was made from
+     */
+    void record_call_site(const std::source_location& where, size_t size_in_bytes);
+
+    /**
+     * @brief Clear every counter
+     */
+    void clear();
+
+    /**
+     * @brief Write the statistics as a JSON object
+     *
+     * @param out Stream to write to
+     * @return bool Whether writing succeeded
+     */
+    bool write_json(std::FILE* out) const;
+};
+
+} // namespace alloc
+
+// Include template implementation
+#include "ArenaStats.tpp"
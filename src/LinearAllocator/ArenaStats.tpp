@@ -0,0 +1,74 @@
+// src/LinearAllocator/ArenaStats.tpp
+#pragma once
+
+#include <bit>
+#include <cstring>
+
+namespace alloc {
+
+inline void ArenaStats::record_allocation(size_t size_in_bytes, size_t padding, size_t used_after) {
+    allocations++;
+    bytes_requested += size_in_bytes;
+    padding_bytes += padding;
+    if (used_after > high_water_mark) {
+        high_water_mark = used_after;
+    }
+
+    size_t bucket = static_cast<size_t>(std::bit_width(size_in_bytes));
+    size_histogram[bucket < kHistogramBuckets ? bucket : kHistogramBuckets - 1]++;
+}
+
+inline void ArenaStats::record_call_site(const std::source_location& where, size_t size_in_bytes) {
+    // Linear scan: the table is small and hot call sites are found first
+    for (CallSiteStats& site : call_sites) {
+        if (!site.file) {
+            site = CallSiteStats{where.file_name(), where.function_name(), where.line(), 0, 0};
+        } else if (site.line != where.line() || std::strcmp(site.file, where.file_name()) != 0) {
+            continue;
+        }
+        site.allocations++;
+        site.bytes += size_in_bytes;
+        return;
+    }
+    untracked_call_sites++;
+}
+
+inline void ArenaStats::clear() {
+    *this = ArenaStats{};
+}
+
+inline bool ArenaStats::write_json(std::FILE* out) const {
+    std::fprintf(out,
+                 "{\"allocations\": %llu, \"bytes_requested\": %llu, \"padding_bytes\": %llu, "
+                 "\"high_water_mark\": %llu, \"resizes_in_place\": %llu, \"resizes_copied\": %llu, "
+                 "\"out_of_memory\": %llu, \"size_histogram\": [",
+                 static_cast<unsigned long long>(allocations),
+                 static_cast<unsigned long long>(bytes_requested),
+                 static_cast<unsigned long long>(padding_bytes),
+                 static_cast<unsigned long long>(high_water_mark),
+                 static_cast<unsigned long long>(resizes_in_place),
+                 static_cast<unsigned long long>(resizes_copied),
+                 static_cast<unsigned long long>(out_of_memory));
+    for (size_t i = 0; i < kHistogramBuckets; i++) {
+        std::fprintf(out, "%s%llu", i ? ", " : "",
+                     static_cast<unsigned long long>(size_histogram[i]));
+    }
+
+    std::fprintf(out, "], \"call_sites\": [");
+    bool first = true;
+    for (const CallSiteStats& site : call_sites) {
+        if (!site.file) {
+            break;
+        }
+        std::fprintf(out, "%s{\"file\": \"%s\", \"line\": %u, \"function\": \"%s\", "
+                          "\"allocations\": %llu, \"bytes\": %llu}",
+                     first ? "" : ", ", site.file, static_cast<unsigned>(site.line), site.function,
+                     static_cast<unsigned long long>(site.allocations),
+                     static_cast<unsigned long long>(site.bytes));
+        first = false;
+    }
+    return std::fprintf(out, "], \"untracked_call_sites\": %llu}\n",
+                        static_cast<unsigned long long>(untracked_call_sites)) > 0;
+}
+
+} // namespace alloc
@@ -0,0 +1,152 @@
+// src/LinearAllocator/ArenaTrace.hpp
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <expected>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "AllocError.hpp"
+
+/**
+ * Tracing is opt-in: define LINEAR_ALLOCATOR_TRACE (or configure CMake with
+ * -DLINEAR_ALLOCATOR_TRACE=ON) to compile recording hooks into LinearAllocator's
+ * allocate_bytes, allocate_batch, resize, reset and TempArenaMemory begin/end.
+ * Hooks do nothing until trace_start() opens a trace file. Without the define
+ * every hook is compiled out; the reader below is always available.
+ */
+#ifndef LINEAR_ALLOCATOR_TRACE_BUFFER
+#define LINEAR_ALLOCATOR_TRACE_BUFFER 4096 ///< Events buffered per thread before they are written
+#endif
+
+namespace alloc {
+
+/**
+ * @brief What a trace event records
+ */
+enum class TraceKind : uint8_t {
+    Allocate,  ///< allocate_bytes or one request of allocate_batch
+    Resize,    ///< resize of the last allocation, in place
+    Reset,     ///< reset()
+    TempBegin, ///< TempArenaMemory::begin
+    TempEnd    ///< TempArenaMemory::end
+};
+
+/**
+ * @brief One recorded event, 32 bytes in the trace file
+ *
+ * Arenas are identified by the address of their LinearAllocator, so wrappers
+ * that rebind their arena to new blocks keep one identity. An arena that is
+ * destroyed and another created at the same address share it.
+ */
+struct TraceEvent {
+    uint64_t arena;         ///< Address of the LinearAllocator
+    uint64_t size;          ///< Allocate: bytes requested; Resize: new size; TempBegin and TempEnd: saved offset
+    uint64_t extra;         ///< Allocate: arena capacity; Resize: old size; otherwise 0
+    uint32_t thread;        ///< Recording thread, numbered from 0 in order of first event
+    uint8_t kind;           ///< A TraceKind
+    uint8_t alignment_log2; ///< log2 of the alignment for Allocate and Resize
+    uint8_t succeeded;      ///< 0 when the allocation or resize ran out of memory
+    uint8_t reserved;       ///< Always 0
+};
+static_assert(sizeof(TraceEvent) == 32, "Trace events are 32 bytes in the file");
+
+/**
+ * @brief Start of every trace file
+ */
+struct TraceFileHeader {
+    char magic[8];       ///< kTraceMagic
+    uint32_t version;    ///< Format version, currently 1
+    uint32_t event_size; ///< sizeof(TraceEvent)
+};
+
+inline constexpr char kTraceMagic[8] = {'L', 'I', 'N', 'T', 'R', 'A', 'C', 'E'};
+inline constexpr uint32_t kTraceVersion = 1;
+inline constexpr size_t kTraceBufferEvents = LINEAR_ALLOCATOR_TRACE_BUFFER;
+
+/**
+ * @brief Process-wide destination of the per-thread buffers
+ *
+ * Recording is lock-free: events go to a thread_local buffer, and only a full
+ * buffer takes the mutex to be written to the file.
+ */
+struct TraceSink {
+    std::FILE* file = nullptr;               ///< Open trace file, nullptr when not recording
+    std::mutex mutex;                        ///< Serializes buffer writes to the file
+    std::atomic<bool> active{false};         ///< Whether hooks record events
+    std::atomic<uint32_t> next_thread{0};    ///< Number given to the next recording thread
+    std::atomic<uint32_t> session{0};        ///< Incremented by every trace_start()
+};
+
+/**
+ * @brief Events of one thread waiting to be written, flushed when full and at thread exit
+ */
+struct TraceBuffer {
+    std::unique_ptr<TraceEvent[]> events;  ///< Buffered events, allocated on the first event
+    size_t count = 0;                      ///< Number of buffered events
+    uint32_t thread = UINT32_MAX;          ///< Number of this thread, assigned on first event
+    uint32_t session = 0;                  ///< Recording session the buffered events belong to
+
+    ~TraceBuffer() {
+        flush();
+    }
+
+    /**
+     * @brief Write the buffered events to the sink, dropping them if their session has ended
+     */
+    void flush();
+};
+
+/**
+ * @brief The process-wide trace sink
+ */
+TraceSink& trace_sink();
+
+/**
+ * @brief The calling thread's trace buffer
+ */
+TraceBuffer& thread_trace_buffer();
+
+/**
+ * @brief Open a trace file and start recording
+ *
+ * @param path File to write, truncated if it exists
+ * @return std::expected<void, AllocError> Nothing or FileError
+ */
+std::expected<void, AllocError> trace_start(const char* path);
+
+/**
+ * @brief Stop recording, write the calling thread's events and close the file
+ *
+ * Other threads write their buffers when they fill up or the thread exits; join
+ * them, or call trace_flush() on them, before stopping or their last events are
+ * dropped. Events of a stopped session never end up in a later trace.
+ */
+void trace_stop();
+
+/**
+ * @brief Write the calling thread's buffered events now
+ */
+void trace_flush();
+
+/**
+ * @brief Record an event if tracing is active
+ */
+void trace_record(TraceKind kind, const void* arena, uint64_t size, uint64_t extra,
+                  size_t alignment, bool succeeded);
+
+/**
+ * @brief Read every event of a trace file
+ *
+ * @param path File written by a recording
+ * @return std::expected<std::vector<TraceEvent>, AllocError> The events in file order, or FileError
+ */
+std::expected<std::vector<TraceEvent>, AllocError> read_trace(const char* path);
+
+} // namespace alloc
+
+// Include template implementation
+#include "ArenaTrace.tpp"
@@ -0,0 +1,135 @@
+// src/LinearAllocator/ArenaTrace.tpp
+#pragma once
+
+#include <bit>
+#include <cstring>
+
+namespace alloc {
+
+inline TraceSink& trace_sink() {
+    static TraceSink sink;
+    return sink;
+}
+
+inline TraceBuffer& thread_trace_buffer() {
+    thread_local TraceBuffer buffer;
+    return buffer;
+}
+
+inline void TraceBuffer::flush() {
+    if (count == 0) {
+        return;
+    }
+    TraceSink& sink = trace_sink();
+    std::lock_guard<std::mutex> lock(sink.mutex);
+    if (sink.file && session == sink.session.load(std::memory_order_relaxed)) {
+        std::fwrite(events.get(), sizeof(TraceEvent), count, sink.file);
+    }
+    count = 0;
+}
+
+inline std::expected<void, AllocError> trace_start(const char* path) {
+    TraceSink& sink = trace_sink();
+    std::lock_guard<std::mutex> lock(sink.mutex);
+    if (sink.file) {
+        return std::unexpected(AllocError::FileError); // Already recording
+    }
+
+    std::FILE* file = std::fopen(path, "wb");
+    if (!file) {
+        return std::unexpected(AllocError::FileError);
+    }
+    TraceFileHeader header{};
+    std::memcpy(header.magic, kTraceMagic, sizeof(header.magic));
+    header.version = kTraceVersion;
+    header.event_size = sizeof(TraceEvent);
+    if (std::fwrite(&header, sizeof(header), 1, file) != 1) {
+        std::fclose(file);
+        return std::unexpected(AllocError::FileError);
+    }
+
+    sink.file = file;
+    sink.session.fetch_add(1, std::memory_order_relaxed);
+    sink.active.store(true, std::memory_order_release);
+    return {};
+}
+
+inline void trace_stop() {
+    TraceSink& sink = trace_sink();
+    sink.active.store(false, std::memory_order_release);
+    thread_trace_buffer().flush();
+
+    std::lock_guard<std::mutex> lock(sink.mutex);
+    if (sink.file) {
+        std::fclose(sink.file);
+        sink.file = nullptr;
+    }
+}
+
+inline void trace_flush() {
+    thread_trace_buffer().flush();
+}
+
+inline void trace_record(TraceKind kind, const void* arena, uint64_t size, uint64_t extra,
+                         size_t alignment, bool succeeded) {
+    if (!trace_sink().active.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    TraceBuffer& buffer = thread_trace_buffer();
+    if (!buffer.events) {
+        buffer.events = std::make_unique<TraceEvent[]>(kTraceBufferEvents);
+        buffer.thread = trace_sink().next_thread.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Events left over from a stopped session are dropped, not written into this one
+    uint32_t session = trace_sink().session.load(std::memory_order_relaxed);
+    if (buffer.session != session) {
+        buffer.count = 0;
+        buffer.session = session;
+    }
+
+    TraceEvent& event = buffer.events[buffer.count++];
+    event.arena = reinterpret_cast<uintptr_t>(arena);
+    event.size = size;
+    event.extra = extra;
+    event.thread = buffer.thread;
+    event.kind = static_cast<uint8_t>(kind);
+    event.alignment_log2 = alignment ? static_cast<uint8_t>(std::countr_zero(alignment)) : 0;
+    event.succeeded = succeeded ? 1 : 0;
+    event.reserved = 0;
+
+    if (buffer.count == kTraceBufferEvents) {
+        buffer.flush();
+    }
+}
+
+inline std::expected<std::vector<TraceEvent>, AllocError> read_trace(const char* path) {
+    std::FILE* file = std::fopen(path, "rb");
+    if (!file) {
+        return std::unexpected(AllocError::FileError);
+    }
+
+    TraceFileHeader header{};
+    if (std::fread(&header, sizeof(header), 1, file) != 1 ||
+        std::memcmp(header.magic, kTraceMagic, sizeof(header.magic)) != 0 ||
+        header.version != kTraceVersion || header.event_size != sizeof(TraceEvent)) {
+        std::fclose(file);
+        return std::unexpected(AllocError::FileError);
+    }
+
+    std::vector<TraceEvent> events;
+    TraceEvent chunk[256];
+    size_t got;
+    while ((got = std::fread(chunk, sizeof(TraceEvent), 256, file)) > 0) {
+        events.insert(events.end(), chunk, chunk + got);
+    }
+    bool failed = std::ferror(file) != 0;
+    std::fclose(file);
+    if (failed) {
+        return std::unexpected(AllocError::FileError);
+    }
+    return events;
+}
+
+} // namespace alloc
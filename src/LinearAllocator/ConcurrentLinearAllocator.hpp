@@ -0,0 +1,148 @@
+// src/LinearAllocator/ConcurrentLinearAllocator.hpp
+#pragma once
+
+#include <atomic>
+#include <cstring>
+#include "LinearAllocator.hpp"
+
+namespace alloc {
+
+/**
+ * @brief Assumed cache line size, used to keep shared counters on their own line
+ */
+inline constexpr size_t kCacheLineSize = 64;
+
+/**
+ * @brief A lock-free linear allocator that can be shared between threads
+ *
+ * Space is claimed with a compare-and-swap on the `used` offset, so concurrent
+ * allocations never overlap and never block each other. There is no `prev_used`:
+ * the last allocation is whichever one currently ends at `used`.
+ *
+ * Resize rule: an allocation is resized in place only while it is still the last
+ * allocation of the arena, i.e. the compare-and-swap of `used` from its old end to
+ * its new end succeeds. If another thread allocated after it, growing falls back to
+ * allocating new memory and copying, and shrinking returns the same pointer without
+ * reclaiming the tail.
+ *
+ * `reset()` and moving the allocator are not thread-safe; they must only happen
+ * while no other thread is using the allocator.
+ */
+struct ConcurrentLinearAllocator {
+    uint8_t* buffer;    ///< Pointer to the memory buffer
+    size_t capacity;    ///< Total capacity of the allocator in bytes
+    size_t known_zero_offset; ///< Memory at or past this offset is zero, only moved by reset()
+    bool zero_on_alloc; ///< Whether to zero memory on allocation
+    alignas(kCacheLineSize) std::atomic<size_t> used; ///< Current number of bytes used
+
+    /**
+     * @brief Construct a new Concurrent Linear Allocator
+     *
+     * @param buffer_ptr Pointer to the memory buffer
+     * @param capacity_in_bytes Capacity of the allocator in bytes
+     * @param zero_memory Whether to zero memory on allocation
+     */
+    ConcurrentLinearAllocator(uint8_t* buffer_ptr, size_t capacity_in_bytes, bool zero_memory = true)
+        : buffer(buffer_ptr), capacity(capacity_in_bytes),
+          known_zero_offset(capacity_in_bytes), zero_on_alloc(zero_memory), used(0) {}
+
+    /**
+     * @brief Move an allocator that is not shared yet
+     */
+    ConcurrentLinearAllocator(ConcurrentLinearAllocator&& other) noexcept
+        : buffer(other.buffer), capacity(other.capacity),
+          known_zero_offset(other.known_zero_offset), zero_on_alloc(other.zero_on_alloc),
+          used(other.used.load(std::memory_order_relaxed)) {}
+
+    /**
+     * @brief Create a new Concurrent Linear Allocator with a given capacity
+     *
+     * @param size_in_bytes The total size of the allocator in bytes
+     * @param zero_memory Whether to zero memory on allocation
+     * @return std::expected<ConcurrentLinearAllocator, AllocError> A new allocator or an error
+     */
+    static std::expected<ConcurrentLinearAllocator, AllocError> create(
+        size_t size_in_bytes, bool zero_memory = true);
+
+    /**
+     * @brief Create a new Concurrent Linear Allocator from an existing buffer
+     *
+     * @param buffer_ptr Pointer to the memory buffer
+     * @param size_in_bytes The total size of the buffer in bytes
+     * @param zero_memory Whether to zero memory on allocation
+     * @return std::expected<ConcurrentLinearAllocator, AllocError> A new allocator or an error
+     */
+    static std::expected<ConcurrentLinearAllocator, AllocError> create_from_buffer(
+        uint8_t* buffer_ptr, size_t size_in_bytes, bool zero_memory = true);
+
+    /**
+     * @brief Allocate memory with a specified alignment
+     *
+     * @tparam T The type to allocate for
+     * @param count The number of elements to allocate
+     * @param alignment The alignment required (must be a power of 2)
+     * @return std::expected<T*, AllocError> Pointer to the allocated memory or an error
+     */
+    template <typename T>
+    std::expected<T*, AllocError> allocate(size_t count = 1, size_t alignment = alignof(T));
+
+    /**
+     * @brief Allocate uninitialized memory with a specified alignment
+     *
+     * Safe to call from any number of threads at the same time.
+     *
+     * @param size_in_bytes The size to allocate in bytes
+     * @param alignment The alignment required (must be a power of 2)
+     * @return std::expected<void*, AllocError> Pointer to the allocated memory or an error
+     */
+    std::expected<void*, AllocError> allocate_bytes(size_t size_in_bytes,
+                                                   size_t alignment = alignof(std::max_align_t));
+
+    /**
+     * @brief Resize an allocation, in place if it is still the last one
+     *
+     * Safe to call concurrently with allocations from other threads, see the
+     * resize rule in the struct description.
+     *
+     * @tparam T The type of the allocation
+     * @param old_ptr Pointer to the old memory
+     * @param old_count Old element count
+     * @param new_count New element count
+     * @param alignment Alignment requirements
+     * @return std::expected<T*, AllocError> Pointer to resized memory or an error
+     */
+    template <typename T>
+    std::expected<T*, AllocError> resize(T* old_ptr, size_t old_count,
+                                         size_t new_count,
+                                         size_t alignment = alignof(T));
+
+    /**
+     * @brief Reset the allocator, effectively freeing all allocations
+     *
+     * Must not be called while other threads are allocating.
+     */
+    void reset() {
+        size_t high = used.load(std::memory_order_relaxed);
+        if (high > known_zero_offset) {
+            known_zero_offset = high;
+        }
+        used.store(0, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Zero the part of [begin, end) that lies below the known-zero watermark
+     */
+    void zero_dirty(size_t begin, size_t end) {
+        if (end > known_zero_offset) {
+            end = known_zero_offset;
+        }
+        if (begin < end) {
+            zero_bytes(buffer + begin, end - begin);
+        }
+    }
+};
+
+} // namespace alloc
+
+// Include template implementation
+#include "ConcurrentLinearAllocator.tpp"
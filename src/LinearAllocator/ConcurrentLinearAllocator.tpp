@@ -0,0 +1,146 @@
+// src/LinearAllocator/ConcurrentLinearAllocator.tpp
+#pragma once
+
+#include <cstdlib>
+#include <cstring>
+
+namespace alloc {
+
+inline std::expected<ConcurrentLinearAllocator, AllocError> ConcurrentLinearAllocator::create(
+    size_t size_in_bytes, bool zero_memory) {
+
+    if (size_in_bytes == 0) {
+        return std::unexpected(AllocError::OutOfMemory);
+    }
+
+    // calloc can hand out fresh zero pages without touching them
+    uint8_t* mem = static_cast<uint8_t*>(zero_memory ? std::calloc(size_in_bytes, 1)
+                                                     : std::malloc(size_in_bytes));
+    if (!mem) {
+        return std::unexpected(AllocError::OutOfMemory);
+    }
+
+    ConcurrentLinearAllocator result(mem, size_in_bytes, zero_memory);
+    if (zero_memory) {
+        result.known_zero_offset = 0;
+    }
+    return result;
+}
+
+inline std::expected<ConcurrentLinearAllocator, AllocError> ConcurrentLinearAllocator::create_from_buffer(
+    uint8_t* buffer_ptr, size_t size_in_bytes, bool zero_memory) {
+
+    if (!buffer_ptr || size_in_bytes == 0) {
+        return std::unexpected(AllocError::OutOfMemory);
+    }
+
+    // Nothing is zeroed upfront, allocations are zeroed as they are handed out
+    return ConcurrentLinearAllocator(buffer_ptr, size_in_bytes, zero_memory);
+}
+
+inline std::expected<void*, AllocError> ConcurrentLinearAllocator::allocate_bytes(
+    size_t size_in_bytes, size_t alignment) {
+
+    // Ensure alignment is a power of 2
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+        return std::unexpected(AllocError::InvalidAlignment);
+    }
+
+    uintptr_t buffer_addr = reinterpret_cast<uintptr_t>(buffer);
+    size_t current = used.load(std::memory_order_relaxed);
+    size_t offset;
+
+    // Claim [offset, offset + size) by moving 'used' past it, retrying if another
+    // thread moved it first. Acquire pairs with the release in resize(), so a tail
+    // zeroed by a shrink is seen as zero here.
+    do {
+        uintptr_t aligned = (buffer_addr + current + alignment - 1) & ~(alignment - 1);
+        offset = aligned - buffer_addr;
+
+        if (offset > capacity || size_in_bytes > capacity - offset) {
+            return std::unexpected(AllocError::OutOfMemory);
+        }
+    } while (!used.compare_exchange_weak(current, offset + size_in_bytes,
+                                         std::memory_order_acquire,
+                                         std::memory_order_relaxed));
+
+    // Zero the memory if requested, skipping memory that was never handed out
+    if (zero_on_alloc) {
+        zero_dirty(offset, offset + size_in_bytes);
+    }
+
+    return buffer + offset;
+}
+
+template <typename T>
+inline std::expected<T*, AllocError> ConcurrentLinearAllocator::allocate(
+    size_t count, size_t alignment) {
+
+    if (count == 0) {
+        return static_cast<T*>(nullptr);
+    }
+
+    auto result = allocate_bytes(count * sizeof(T), alignment);
+    if (!result) {
+        return std::unexpected(result.error());
+    }
+
+    return static_cast<T*>(result.value());
+}
+
+template <typename T>
+inline std::expected<T*, AllocError> ConcurrentLinearAllocator::resize(
+    T* old_ptr, size_t old_count, size_t new_count, size_t alignment) {
+
+    if (!old_ptr || old_count == 0) {
+        return allocate<T>(new_count, alignment);
+    }
+
+    size_t old_size = old_count * sizeof(T);
+    size_t new_size = new_count * sizeof(T);
+    size_t old_offset = reinterpret_cast<uint8_t*>(old_ptr) - buffer;
+    size_t old_end = old_offset + old_size;
+
+    // In place only while this is still the last allocation
+    if (old_offset + new_size <= capacity) {
+        // A tail released by shrinking becomes claimable by other threads as soon
+        // as 'used' moves below it, and allocate_bytes does not zero memory above
+        // the watermark, so that part is cleared before publishing. The caller discards
+        // those bytes either way, so this is harmless if the exchange fails.
+        if (zero_on_alloc && new_size < old_size) {
+            size_t tail = old_offset + new_size;
+            if (tail < known_zero_offset) {
+                tail = known_zero_offset;
+            }
+            if (tail < old_end) {
+                zero_bytes(buffer + tail, old_end - tail);
+            }
+        }
+
+        size_t expected = old_end;
+        if (used.compare_exchange_strong(expected, old_offset + new_size,
+                                         std::memory_order_acq_rel,
+                                         std::memory_order_relaxed)) {
+            // Zero any new memory if expanding
+            if (zero_on_alloc && new_size > old_size) {
+                zero_dirty(old_end, old_offset + new_size);
+            }
+            return old_ptr;
+        }
+    }
+
+    // Someone allocated after us: shrinking keeps the block, growing copies
+    if (new_size <= old_size) {
+        return old_ptr;
+    }
+
+    auto new_mem = allocate<T>(new_count, alignment);
+    if (!new_mem) {
+        return std::unexpected(new_mem.error());
+    }
+
+    copy_bytes(new_mem.value(), old_ptr, old_size);
+    return new_mem;
+}
+
+} // namespace alloc
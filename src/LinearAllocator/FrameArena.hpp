@@ -0,0 +1,251 @@
+// src/LinearAllocator/FrameArena.hpp
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <utility>
+#include "ConcurrentLinearAllocator.hpp"
+
+namespace alloc {
+
+/**
+ * @brief A published frame as seen by the consumer
+ */
+struct FrameView {
+    uint64_t frame;         ///< Frame number, counting from 0
+    LinearAllocator* arena; ///< Arena the frame was built in
+    void* payload;          ///< Root pointer passed to end_frame()
+};
+
+/**
+ * @brief N linear allocators used in turn by a producer and a consumer stage
+ *
+ * The producer builds frame f in arena f % kFrames and publishes it with
+ * end_frame(); the consumer reads it and hands it back with release_frame().
+ * Before the producer reuses an arena it resets it, which it may only do once
+ * the consumer has released the frame that last lived there. kFrames = 2 is
+ * double buffering; more frames let the producer run further ahead.
+ *
+ * The two frame fences, `published` and `released`, are monotonic counters on
+ * their own cache lines. Each is written by one side with release ordering and
+ * read by the other with acquire ordering, so the handoff is lock-free and
+ * everything written to a frame is visible to the consumer that acquires it.
+ *
+ * Only one producer thread and one consumer thread may use the ring.
+ *
+ * @tparam kFrames Number of arenas in the ring, at least 2
+ */
+template <size_t kFrames = 2>
+struct FrameArenaRing {
+    static_assert(kFrames >= 2, "A frame ring needs at least two arenas");
+
+    std::array<LinearAllocator, kFrames> arenas; ///< One arena per frame slot, carved from `buffer`
+    std::array<void*, kFrames> payloads;         ///< Root pointer of the frame in each slot
+    uint8_t* buffer;                             ///< Memory shared by all arenas
+    size_t frame_capacity;                       ///< Capacity of each arena in bytes
+
+    alignas(kCacheLineSize) std::atomic<uint64_t> published; ///< Frames finished by the producer
+    alignas(kCacheLineSize) std::atomic<uint64_t> released;  ///< Frames finished by the consumer
+    alignas(kCacheLineSize) uint64_t producer_frame;         ///< Frame being built, producer only
+    alignas(kCacheLineSize) uint64_t consumer_frame;         ///< Next frame to read, consumer only
+
+    /**
+     * @brief Construct a ring over `kFrames * frame_bytes` bytes of memory
+     *
+     * @param buffer_ptr Pointer to the memory buffer
+     * @param frame_bytes Capacity of each arena in bytes
+     * @param zero_memory Whether the arenas zero memory on allocation
+     */
+    FrameArenaRing(uint8_t* buffer_ptr, size_t frame_bytes, bool zero_memory = true)
+        : FrameArenaRing(buffer_ptr, frame_bytes, zero_memory, std::make_index_sequence<kFrames>{}) {}
+
+    /**
+     * @brief Move a ring that is not shared yet
+     */
+    FrameArenaRing(FrameArenaRing&& other) noexcept
+        : arenas(other.arenas), payloads(other.payloads), buffer(other.buffer),
+          frame_capacity(other.frame_capacity),
+          published(other.published.load(std::memory_order_relaxed)),
+          released(other.released.load(std::memory_order_relaxed)),
+          producer_frame(other.producer_frame), consumer_frame(other.consumer_frame) {}
+
+    /**
+     * @brief Create a new frame ring with a given capacity per frame
+     *
+     * @param frame_bytes Capacity of each arena in bytes
+     * @param zero_memory Whether the arenas zero memory on allocation
+     * @return std::expected<FrameArenaRing, AllocError> A new ring or an error
+     */
+    static std::expected<FrameArenaRing, AllocError> create(size_t frame_bytes, bool zero_memory = true);
+
+    /**
+     * @brief Producer: reset the next arena and start building a frame in it
+     *
+     * Calling it again before end_frame() restarts the same frame.
+     *
+     * @return std::expected<LinearAllocator*, AllocError> The arena of the new frame, or
+     *         WouldBlock if the consumer still holds the frame that lives in it
+     */
+    std::expected<LinearAllocator*, AllocError> begin_frame();
+
+    /**
+     * @brief Producer: like begin_frame(), but wait until the consumer frees the arena
+     */
+    std::expected<LinearAllocator*, AllocError> wait_begin_frame();
+
+    /**
+     * @brief Producer: publish the current frame to the consumer
+     *
+     * @param payload Root pointer handed to the consumer with the frame
+     */
+    void end_frame(void* payload = nullptr);
+
+    /**
+     * @brief Consumer: get the oldest published frame without taking it off the ring
+     *
+     * @return std::expected<FrameView, AllocError> The frame, or WouldBlock if none is published
+     */
+    std::expected<FrameView, AllocError> acquire_frame();
+
+    /**
+     * @brief Consumer: like acquire_frame(), but wait until the producer publishes one
+     */
+    FrameView wait_acquire_frame();
+
+    /**
+     * @brief Consumer: hand the acquired frame back so its arena can be reset
+     *
+     * Nothing read from the frame may be used afterwards.
+     */
+    void release_frame();
+
+    /**
+     * @brief Run the destructors of every frame and free the buffer
+     *
+     * Must only be called once both stages have stopped.
+     */
+    void destroy();
+
+private:
+    template <size_t... I>
+    FrameArenaRing(uint8_t* buffer_ptr, size_t frame_bytes, bool zero_memory, std::index_sequence<I...>)
+        : arenas{LinearAllocator(buffer_ptr + I * frame_bytes, frame_bytes, zero_memory)...},
+          payloads{}, buffer(buffer_ptr), frame_capacity(frame_bytes),
+          published(0), released(0), producer_frame(0), consumer_frame(0) {}
+};
+
+/**
+ * @brief A ring buffer allocator whose offset wraps around to reclaim the oldest memory
+ *
+ * Allocations are carved from the head in order. An allocation that does not fit
+ * before the end of the buffer wraps to the start, skipping the tail bytes. Memory
+ * is handed back in the same order with release_until(mark), where `mark` is the
+ * value mark() returned right after the last allocation to reclaim. Positions are
+ * 64-bit counters that only grow, so a mark never becomes ambiguous after a wrap.
+ *
+ * One thread may allocate while another releases: `head` is producer-only and
+ * `tail` is published with release ordering. reset() is not thread-safe.
+ */
+struct RingAllocator {
+    uint8_t* buffer;      ///< Pointer to the memory buffer
+    size_t capacity;      ///< Total capacity in bytes
+    size_t head_offset;   ///< Offset in the buffer where the next allocation starts
+    uint64_t head;        ///< Position of the end of the newest allocation
+    bool zero_on_alloc;   ///< Whether to zero memory on allocation
+
+    alignas(kCacheLineSize) std::atomic<uint64_t> tail; ///< Position of the start of the oldest live memory
+
+    /**
+     * @brief Construct a new Ring Allocator
+     *
+     * @param buffer_ptr Pointer to the memory buffer
+     * @param capacity_in_bytes Capacity of the allocator in bytes
+     * @param zero_memory Whether to zero memory on allocation
+     */
+    RingAllocator(uint8_t* buffer_ptr, size_t capacity_in_bytes, bool zero_memory = true)
+        : buffer(buffer_ptr), capacity(capacity_in_bytes), head_offset(0), head(0),
+          zero_on_alloc(zero_memory), tail(0) {}
+
+    /**
+     * @brief Move an allocator that is not shared yet
+     */
+    RingAllocator(RingAllocator&& other) noexcept
+        : buffer(other.buffer), capacity(other.capacity), head_offset(other.head_offset),
+          head(other.head), zero_on_alloc(other.zero_on_alloc),
+          tail(other.tail.load(std::memory_order_relaxed)) {}
+
+    /**
+     * @brief Create a new Ring Allocator with a given capacity
+     *
+     * @param size_in_bytes The total size of the allocator in bytes
+     * @param zero_memory Whether to zero memory on allocation
+     * @return std::expected<RingAllocator, AllocError> A new allocator or an error
+     */
+    static std::expected<RingAllocator, AllocError> create(size_t size_in_bytes, bool zero_memory = true);
+
+    /**
+     * @brief Create a new Ring Allocator from an existing buffer
+     *
+     * @param buffer_ptr Pointer to the memory buffer
+     * @param size_in_bytes The total size of the buffer in bytes
+     * @param zero_memory Whether to zero memory on allocation
+     * @return std::expected<RingAllocator, AllocError> A new allocator or an error
+     */
+    static std::expected<RingAllocator, AllocError> create_from_buffer(
+        uint8_t* buffer_ptr, size_t size_in_bytes, bool zero_memory = true);
+
+    /**
+     * @brief Allocate memory with a specified alignment
+     *
+     * @tparam T The type to allocate for
+     * @param count The number of elements to allocate
+     * @param alignment The alignment required (must be a power of 2)
+     * @return std::expected<T*, AllocError> Pointer to the allocated memory or an error
+     */
+    template <typename T>
+    std::expected<T*, AllocError> allocate(size_t count = 1, size_t alignment = alignof(T));
+
+    /**
+     * @brief Allocate uninitialized memory at the head, wrapping if needed
+     *
+     * @param size_in_bytes The size to allocate in bytes
+     * @param alignment The alignment required (must be a power of 2)
+     * @return std::expected<void*, AllocError> Pointer to the allocated memory, OutOfMemory if
+     *         the request can never fit, or WouldBlock if the oldest memory is not released yet
+     */
+    std::expected<void*, AllocError> allocate_bytes(size_t size_in_bytes,
+                                                   size_t alignment = alignof(std::max_align_t));
+
+    /**
+     * @brief Position of the end of the newest allocation, to pass to release_until()
+     */
+    uint64_t mark() const { return head; }
+
+    /**
+     * @brief Reclaim every allocation made before `position` was returned by mark()
+     */
+    void release_until(uint64_t position) {
+        tail.store(position, std::memory_order_release);
+    }
+
+    /**
+     * @brief Number of bytes between the oldest live memory and the head, wrap padding included
+     */
+    size_t in_use() const {
+        return static_cast<size_t>(head - tail.load(std::memory_order_acquire));
+    }
+
+    /**
+     * @brief Reclaim everything at once
+     */
+    void reset() {
+        head_offset = 0;
+        head = 0;
+        tail.store(0, std::memory_order_relaxed);
+    }
+};
+
+} // namespace alloc
+
+// Include template implementation
+#include "FrameArena.tpp"
@@ -0,0 +1,179 @@
+// src/LinearAllocator/FrameArena.tpp
+#pragma once
+
+#include <cstdlib>
+
+namespace alloc {
+
+template <size_t kFrames>
+inline std::expected<FrameArenaRing<kFrames>, AllocError> FrameArenaRing<kFrames>::create(
+    size_t frame_bytes, bool zero_memory) {
+
+    if (frame_bytes == 0) {
+        return std::unexpected(AllocError::OutOfMemory);
+    }
+
+    // Start every arena on its own cache line so neighbouring frames never share one
+    frame_bytes = (frame_bytes + kCacheLineSize - 1) & ~(kCacheLineSize - 1);
+    uint8_t* mem = static_cast<uint8_t*>(std::aligned_alloc(kCacheLineSize, frame_bytes * kFrames));
+    if (!mem) {
+        return std::unexpected(AllocError::OutOfMemory);
+    }
+
+    // Nothing is zeroed upfront, each arena zeroes allocations as they are handed out
+    return FrameArenaRing(mem, frame_bytes, zero_memory);
+}
+
+template <size_t kFrames>
+inline std::expected<LinearAllocator*, AllocError> FrameArenaRing<kFrames>::begin_frame() {
+    // Acquire pairs with release_frame(): the consumer is done reading before we reset
+    if (producer_frame - released.load(std::memory_order_acquire) >= kFrames) {
+        return std::unexpected(AllocError::WouldBlock);
+    }
+
+    LinearAllocator& arena = arenas[producer_frame % kFrames];
+    arena.reset();
+    payloads[producer_frame % kFrames] = nullptr;
+    return &arena;
+}
+
+template <size_t kFrames>
+inline std::expected<LinearAllocator*, AllocError> FrameArenaRing<kFrames>::wait_begin_frame() {
+    uint64_t seen = released.load(std::memory_order_acquire);
+    while (producer_frame - seen >= kFrames) {
+        released.wait(seen, std::memory_order_acquire);
+        seen = released.load(std::memory_order_acquire);
+    }
+    return begin_frame();
+}
+
+template <size_t kFrames>
+inline void FrameArenaRing<kFrames>::end_frame(void* payload) {
+    payloads[producer_frame % kFrames] = payload;
+    producer_frame++;
+    published.store(producer_frame, std::memory_order_release);
+    published.notify_one();
+}
+
+template <size_t kFrames>
+inline std::expected<FrameView, AllocError> FrameArenaRing<kFrames>::acquire_frame() {
+    // Acquire pairs with end_frame(): everything built in the frame is visible
+    if (consumer_frame == published.load(std::memory_order_acquire)) {
+        return std::unexpected(AllocError::WouldBlock);
+    }
+
+    size_t slot = consumer_frame % kFrames;
+    return FrameView{consumer_frame, &arenas[slot], payloads[slot]};
+}
+
+template <size_t kFrames>
+inline FrameView FrameArenaRing<kFrames>::wait_acquire_frame() {
+    uint64_t seen = published.load(std::memory_order_acquire);
+    while (consumer_frame == seen) {
+        published.wait(seen, std::memory_order_acquire);
+        seen = published.load(std::memory_order_acquire);
+    }
+
+    size_t slot = consumer_frame % kFrames;
+    return FrameView{consumer_frame, &arenas[slot], payloads[slot]};
+}
+
+template <size_t kFrames>
+inline void FrameArenaRing<kFrames>::release_frame() {
+    consumer_frame++;
+    released.store(consumer_frame, std::memory_order_release);
+    released.notify_one();
+}
+
+template <size_t kFrames>
+inline void FrameArenaRing<kFrames>::destroy() {
+    for (LinearAllocator& arena : arenas) {
+        arena.run_destructors(nullptr);
+        arena.unpoison();
+        arena = LinearAllocator(nullptr, 0, arena.zero_on_alloc);
+    }
+    std::free(buffer);
+    buffer = nullptr;
+}
+
+inline std::expected<RingAllocator, AllocError> RingAllocator::create(
+    size_t size_in_bytes, bool zero_memory) {
+
+    if (size_in_bytes == 0) {
+        return std::unexpected(AllocError::OutOfMemory);
+    }
+
+    uint8_t* mem = static_cast<uint8_t*>(std::malloc(size_in_bytes));
+    if (!mem) {
+        return std::unexpected(AllocError::OutOfMemory);
+    }
+
+    return RingAllocator(mem, size_in_bytes, zero_memory);
+}
+
+inline std::expected<RingAllocator, AllocError> RingAllocator::create_from_buffer(
+    uint8_t* buffer_ptr, size_t size_in_bytes, bool zero_memory) {
+
+    if (!buffer_ptr || size_in_bytes == 0) {
+        return std::unexpected(AllocError::OutOfMemory);
+    }
+
+    return RingAllocator(buffer_ptr, size_in_bytes, zero_memory);
+}
+
+inline std::expected<void*, AllocError> RingAllocator::allocate_bytes(
+    size_t size_in_bytes, size_t alignment) {
+
+    // Ensure alignment is a power of 2
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+        return std::unexpected(AllocError::InvalidAlignment);
+    }
+
+    uintptr_t current = reinterpret_cast<uintptr_t>(buffer + head_offset);
+    size_t adjustment = ((current + alignment - 1) & ~(alignment - 1)) - current;
+    size_t offset = head_offset;
+    uint64_t start = head;
+
+    // Wrap to the start of the buffer, the skipped tail bytes stay in use until released
+    if (head_offset + adjustment + size_in_bytes > capacity) {
+        start += capacity - head_offset;
+        offset = 0;
+        current = reinterpret_cast<uintptr_t>(buffer);
+        adjustment = ((current + alignment - 1) & ~(alignment - 1)) - current;
+        if (adjustment + size_in_bytes > capacity) {
+            return std::unexpected(AllocError::OutOfMemory);
+        }
+    }
+
+    // Acquire pairs with release_until(): the oldest memory is no longer read
+    uint64_t end = start + adjustment + size_in_bytes;
+    if (end - tail.load(std::memory_order_acquire) > capacity) {
+        return std::unexpected(AllocError::WouldBlock);
+    }
+
+    void* result = buffer + offset + adjustment;
+    head_offset = offset + adjustment + size_in_bytes;
+    head = end;
+
+    // Ring memory is always recycled, so there is no known-zero tail to skip
+    if (zero_on_alloc) {
+        zero_bytes(result, size_in_bytes);
+    }
+    return result;
+}
+
+template <typename T>
+inline std::expected<T*, AllocError> RingAllocator::allocate(size_t count, size_t alignment) {
+    if (count == 0) {
+        return static_cast<T*>(nullptr);
+    }
+
+    auto result = allocate_bytes(count * sizeof(T), alignment);
+    if (!result) {
+        return std::unexpected(result.error());
+    }
+
+    return static_cast<T*>(result.value());
+}
+
+} // namespace alloc
@@ -0,0 +1,260 @@
+// src/LinearAllocator/GrowingLinearAllocator.hpp
+#pragma once
+
+#include "LinearAllocator.hpp"
+
+namespace alloc {
+
+/**
+ * @brief Policy used to size the blocks chained by a GrowingLinearAllocator
+ */
+enum class GrowthPolicy {
+    Fixed,     ///< Every new block has the same size (fixed-step growth)
+    Geometric  ///< Every new block is twice the size of the previous one
+};
+
+/**
+ * @brief Header placed at the start of every block owned by a GrowingLinearAllocator
+ *
+ * The usable memory of the block directly follows the header.
+ */
+struct ArenaBlock {
+    ArenaBlock* next;        ///< Next block in the chain (kept across resets for reuse)
+    size_t capacity;         ///< Usable bytes following the header
+    size_t known_zero;       ///< Known-zero watermark of the block while it is not bound
+#ifdef LINEAR_ALLOCATOR_DEBUG
+    size_t used;             ///< Bytes in use while the block is not bound
+    size_t last_guard;       ///< Guard chain of the block while it is not bound
+#endif
+
+    /**
+     * @brief Get a pointer to the usable memory of the block
+     */
+    uint8_t* data() {
+        return reinterpret_cast<uint8_t*>(this) + sizeof(ArenaBlock);
+    }
+};
+
+/**
+ * @brief A linear allocator that chains new blocks instead of running out of memory
+ *
+ * Allocation is delegated to a LinearAllocator bound to the current block, so the
+ * fast path is the same O(1) bump. When the current block is full, the allocator
+ * moves to the next block in the chain, reusing blocks kept from before a reset
+ * or allocating a new one sized by the growth policy.
+ */
+struct GrowingLinearAllocator {
+    LinearAllocator arena;      ///< Allocator bound to the current block
+    ArenaBlock* first_block;    ///< First block of the chain
+    ArenaBlock* current_block;  ///< Block the arena is currently bound to
+    GrowthPolicy growth_policy; ///< How the size of new blocks is chosen
+    size_t block_size;          ///< Size of the first block (and every block for Fixed growth)
+    size_t max_block_size;      ///< Upper bound for geometric growth
+
+    /**
+     * @brief Create a new Growing Linear Allocator
+     *
+     * @param initial_block_size Size of the first block in bytes
+     * @param policy Growth policy for the blocks that follow
+     * @param zero_memory Whether to zero memory on allocation
+     * @param max_block_bytes Upper bound for block sizes chosen by geometric growth
+     * @return std::expected<GrowingLinearAllocator, AllocError> A new allocator or an error
+     */
+    static std::expected<GrowingLinearAllocator, AllocError> create(
+        size_t initial_block_size, GrowthPolicy policy = GrowthPolicy::Geometric,
+        bool zero_memory = true, size_t max_block_bytes = size_t(64) * 1024 * 1024);
+
+    /**
+     * @brief Allocate memory with a specified alignment
+     *
+     * @tparam T The type to allocate for
+     * @param count The number of elements to allocate
+     * @param alignment The alignment required (must be a power of 2)
+     * @return std::expected<T*, AllocError> Pointer to the allocated memory or an error
+     */
+    template <typename T>
+    std::expected<T*, AllocError> allocate(size_t count = 1, size_t alignment = alignof(T)
+                                           LINEAR_ALLOCATOR_CALLSITE_DECL);
+
+    /**
+     * @brief Allocate uninitialized memory with a specified alignment
+     *
+     * @param size_in_bytes The size to allocate in bytes
+     * @param alignment The alignment required (must be a power of 2)
+     * @return std::expected<void*, AllocError> Pointer to the allocated memory or an error
+     */
+    std::expected<void*, AllocError> allocate_bytes(size_t size_in_bytes,
+                                                   size_t alignment = alignof(std::max_align_t)
+                                                   LINEAR_ALLOCATOR_CALLSITE_DECL) {
+        auto result = arena.allocate_bytes(size_in_bytes, alignment LINEAR_ALLOCATOR_CALLSITE_ARG);
+        if (result || result.error() != AllocError::OutOfMemory) {
+            return result;
+        }
+        return allocate_from_next_block(size_in_bytes, alignment LINEAR_ALLOCATOR_CALLSITE_ARG);
+    }
+
+    /**
+     * @brief Allocate and construct an object, see LinearAllocator::make
+     *
+     * The destructor list is kept in `arena` and spans blocks.
+     *
+     * @tparam T The type to construct
+     * @param args Arguments forwarded to the constructor
+     * @return std::expected<T*, AllocError> Pointer to the new object or an error
+     */
+    template <typename T, typename... Args>
+    std::expected<T*, AllocError> make(Args&&... args);
+
+    /**
+     * @brief Allocate and construct an array of objects, see LinearAllocator::make_array
+     *
+     * @tparam T The type to construct
+     * @param count The number of elements
+     * @param args Arguments passed to every element's constructor
+     * @return std::expected<T*, AllocError> Pointer to the first element or an error
+     */
+    template <typename T, typename... Args>
+    std::expected<T*, AllocError> make_array(size_t count, const Args&... args);
+
+    /**
+     * @brief Resize the last allocation made
+     *
+     * Resizes in place when the memory is the last allocation and still fits in the
+     * current block. Otherwise new memory is allocated (possibly in a new block) and
+     * the old data is copied.
+     *
+     * @tparam T The type of the allocation
+     * @param old_ptr Pointer to the old memory
+     * @param old_count Old element count
+     * @param new_count New element count
+     * @param alignment Alignment requirements
+     * @return std::expected<T*, AllocError> Pointer to resized memory or an error
+     */
+    template <typename T>
+    std::expected<T*, AllocError> resize(T* old_ptr, size_t old_count,
+                                         size_t new_count,
+                                         size_t alignment = alignof(T)
+                                         LINEAR_ALLOCATOR_CALLSITE_DECL);
+
+    /**
+     * @brief Reset the allocator, keeping every block for reuse
+     *
+     * Destructors registered by make() and make_array() run first.
+     */
+    void reset() {
+        arena.run_destructors(nullptr);
+#ifdef LINEAR_ALLOCATOR_DEBUG
+        debug_release_blocks(first_block, 0);
+#endif
+        bind_block(first_block, 0);
+    }
+
+    /**
+     * @brief Run registered destructors and free every block owned by the allocator
+     */
+    void destroy();
+
+    /**
+     * @brief Total number of bytes held in blocks, used or not
+     */
+    size_t total_capacity() const;
+
+    /**
+     * @brief Bind the arena to a block, starting at the given offset
+     *
+     * @param block The block to allocate from
+     * @param used_in_block Offset inside the block where allocation continues
+     */
+    void bind_block(ArenaBlock* block, size_t used_in_block) {
+        if (current_block) {
+            current_block->known_zero = arena.known_zero_offset;
+#ifdef LINEAR_ALLOCATOR_DEBUG
+            current_block->used = arena.used;
+            current_block->last_guard = arena.last_guard;
+#endif
+        }
+        current_block = block;
+        arena.buffer = block->data();
+        arena.capacity = block->capacity;
+        arena.used = used_in_block;
+        arena.prev_used = used_in_block;
+        arena.known_zero_offset = block->known_zero;
+#ifdef LINEAR_ALLOCATOR_DEBUG
+        arena.last_guard = block->last_guard;
+#endif
+    }
+
+#ifdef LINEAR_ALLOCATOR_DEBUG
+    /**
+     * @brief Check, fill and poison what is given back by rolling back to `block` at `used_in_block`
+     *
+     * Walks from `block` to the current block, which must come at or after it in the chain.
+     */
+    void debug_release_blocks(ArenaBlock* block, size_t used_in_block);
+#endif
+
+    /**
+     * @brief Slow path of allocate_bytes: move to (or create) a block that fits the request
+     */
+    std::expected<void*, AllocError> allocate_from_next_block(size_t size_in_bytes,
+                                                              size_t alignment
+                                                              LINEAR_ALLOCATOR_CALLSITE_PARAM);
+
+    /**
+     * @brief Allocate a new block able to hold at least the given number of bytes
+     */
+    ArenaBlock* create_block(size_t min_capacity);
+};
+
+/**
+ * @brief Temporary memory savepoint for a GrowingLinearAllocator
+ *
+ * Works like TempArenaMemory but also remembers the current block, so rolling back
+ * across a block boundary rebinds the allocator to the block that was current at
+ * the savepoint. Blocks chained after it are kept for reuse.
+ */
+struct TempGrowingArenaMemory {
+    GrowingLinearAllocator* allocator; ///< Pointer to the allocator
+    ArenaBlock* saved_block;           ///< The block that was current at the savepoint
+    size_t saved_used;                 ///< The saved 'used' offset inside that block
+    DestructorNode* saved_destructors; ///< Destructor list head at the savepoint
+
+    /**
+     * @brief Create a temporary arena memory savepoint
+     *
+     * @param alloc The allocator to create a savepoint for
+     * @return TempGrowingArenaMemory A savepoint that can be used to roll back allocations
+     */
+    static TempGrowingArenaMemory begin(GrowingLinearAllocator& alloc) {
+        return TempGrowingArenaMemory{&alloc, alloc.current_block, alloc.arena.used,
+                                      alloc.arena.destructors};
+    }
+
+    /**
+     * @brief End the temporary arena memory, rolling back any allocations made since creation
+     */
+    void end() {
+        if (allocator) {
+            allocator->arena.run_destructors(saved_destructors);
+#ifdef LINEAR_ALLOCATOR_DEBUG
+            allocator->debug_release_blocks(saved_block, saved_used);
+#endif
+            allocator->bind_block(saved_block, saved_used);
+            allocator = nullptr; // Mark as ended
+        }
+    }
+
+    /**
+     * @brief Destructor that automatically ends the temporary memory if not already ended
+     */
+    ~TempGrowingArenaMemory() {
+        if (allocator) {
+            end();
+        }
+    }
+};
+
+} // namespace alloc
+
+// Include template implementation
+#include "GrowingLinearAllocator.tpp"
@@ -0,0 +1,227 @@
+// src/LinearAllocator/GrowingLinearAllocator.tpp
+#pragma once
+
+#include <cstdlib>
+#include <cstring>
+
+namespace alloc {
+
+inline std::expected<GrowingLinearAllocator, AllocError> GrowingLinearAllocator::create(
+    size_t initial_block_size, GrowthPolicy policy, bool zero_memory, size_t max_block_bytes) {
+
+    if (initial_block_size == 0) {
+        return std::unexpected(AllocError::OutOfMemory);
+    }
+
+    GrowingLinearAllocator result{
+        LinearAllocator(nullptr, 0, zero_memory),
+        nullptr,
+        nullptr,
+        policy,
+        initial_block_size,
+        max_block_bytes < initial_block_size ? initial_block_size : max_block_bytes
+    };
+
+    ArenaBlock* block = result.create_block(initial_block_size);
+    if (!block) {
+        return std::unexpected(AllocError::OutOfMemory);
+    }
+
+    result.first_block = block;
+    result.bind_block(block, 0);
+    return result;
+}
+
+inline ArenaBlock* GrowingLinearAllocator::create_block(size_t min_capacity) {
+    if (min_capacity > SIZE_MAX - sizeof(ArenaBlock)) {
+        return nullptr;
+    }
+
+    // Zeroed blocks come from calloc, so allocate_bytes does not zero them again
+    bool zero = arena.zero_on_alloc;
+    void* mem = zero ? std::calloc(sizeof(ArenaBlock) + min_capacity, 1)
+                     : std::malloc(sizeof(ArenaBlock) + min_capacity);
+    if (!mem) {
+        return nullptr;
+    }
+
+    ArenaBlock* block = static_cast<ArenaBlock*>(mem);
+    block->next = nullptr;
+    block->capacity = min_capacity;
+    block->known_zero = zero ? 0 : min_capacity;
+#ifdef LINEAR_ALLOCATOR_DEBUG
+    block->used = 0;
+    block->last_guard = kNoGuard;
+#endif
+    return block;
+}
+
+#ifdef LINEAR_ALLOCATOR_DEBUG
+inline void GrowingLinearAllocator::debug_release_blocks(ArenaBlock* block, size_t used_in_block) {
+    ArenaBlock* last = current_block;
+    for (ArenaBlock* visited = block;; visited = visited->next) {
+        if (visited != current_block) {
+            bind_block(visited, visited->used);
+        }
+
+        // The target block keeps what was allocated before the savepoint, later blocks nothing
+        size_t keep = visited == block ? used_in_block : 0;
+        arena.debug_release(keep);
+        arena.used = keep;
+
+        if (visited == last) {
+            break;
+        }
+    }
+}
+#endif
+
+inline std::expected<void*, AllocError> GrowingLinearAllocator::allocate_from_next_block(
+    size_t size_in_bytes, size_t alignment LINEAR_ALLOCATOR_CALLSITE_PARAM) {
+
+    // Worst case padding needed to align the allocation at the start of a block
+    if (size_in_bytes > SIZE_MAX - (kRedzoneBytes + alignment - 1)) {
+        return std::unexpected(AllocError::OutOfMemory);
+    }
+    size_t needed = size_in_bytes + kRedzoneBytes + alignment - 1;
+
+    // Reuse the next kept block if it is large enough
+    ArenaBlock* next = current_block->next;
+    if (next && next->capacity >= needed) {
+        bind_block(next, 0);
+        return arena.allocate_bytes(size_in_bytes, alignment LINEAR_ALLOCATOR_CALLSITE_ARG);
+    }
+
+    // Otherwise chain a new block in front of the kept ones
+    size_t new_size = block_size;
+    if (growth_policy == GrowthPolicy::Geometric) {
+        size_t doubled = current_block->capacity > max_block_size / 2
+                             ? max_block_size
+                             : current_block->capacity * 2;
+        new_size = doubled > new_size ? doubled : new_size;
+    }
+    if (new_size < needed) {
+        new_size = needed;
+    }
+
+    ArenaBlock* block = create_block(new_size);
+    if (!block) {
+        return std::unexpected(AllocError::OutOfMemory);
+    }
+
+    block->next = next;
+    current_block->next = block;
+    bind_block(block, 0);
+    return arena.allocate_bytes(size_in_bytes, alignment LINEAR_ALLOCATOR_CALLSITE_ARG);
+}
+
+template <typename T>
+inline std::expected<T*, AllocError> GrowingLinearAllocator::allocate(
+    size_t count, size_t alignment LINEAR_ALLOCATOR_CALLSITE_PARAM) {
+
+    if (count == 0) {
+        return static_cast<T*>(nullptr);
+    }
+
+    auto result = allocate_bytes(count * sizeof(T), alignment LINEAR_ALLOCATOR_CALLSITE_ARG);
+    if (!result) {
+        return std::unexpected(result.error());
+    }
+
+    return static_cast<T*>(result.value());
+}
+
+template <typename T, typename... Args>
+inline std::expected<T*, AllocError> GrowingLinearAllocator::make(Args&&... args) {
+    DestructorNode* node;
+    auto storage = allocate_tracked<T>(*this, arena.destructors, 1, node);
+    if (!storage) {
+        return storage;
+    }
+
+    T* object = new (storage.value()) T(std::forward<Args>(args)...);
+    if (node) {
+        node->count = 1;
+    }
+    return object;
+}
+
+template <typename T, typename... Args>
+inline std::expected<T*, AllocError> GrowingLinearAllocator::make_array(
+    size_t count, const Args&... args) {
+
+    if (count == 0) {
+        return static_cast<T*>(nullptr);
+    }
+
+    DestructorNode* node;
+    auto storage = allocate_tracked<T>(*this, arena.destructors, count, node);
+    if (!storage) {
+        return storage;
+    }
+
+    T* objects = storage.value();
+    for (size_t i = 0; i < count; i++) {
+        new (objects + i) T(args...);
+        if (node) {
+            node->count = i + 1;
+        }
+    }
+    return objects;
+}
+
+template <typename T>
+inline std::expected<T*, AllocError> GrowingLinearAllocator::resize(
+    T* old_ptr, size_t old_count, size_t new_count, size_t alignment LINEAR_ALLOCATOR_CALLSITE_PARAM) {
+
+    if (!old_ptr || old_count == 0) {
+        return allocate<T>(new_count, alignment LINEAR_ALLOCATOR_CALLSITE_ARG);
+    }
+
+    size_t old_size = old_count * sizeof(T);
+    size_t new_size = new_count * sizeof(T);
+
+    // The last allocation of the current block can grow or shrink in place
+    uint8_t* last = arena.buffer + arena.prev_used;
+    if (reinterpret_cast<uint8_t*>(old_ptr) == last &&
+        arena.prev_used + new_size <= arena.capacity) {
+        return arena.resize<T>(old_ptr, old_count, new_count, alignment LINEAR_ALLOCATOR_CALLSITE_ARG);
+    }
+
+    auto new_mem = allocate<T>(new_count, alignment LINEAR_ALLOCATOR_CALLSITE_ARG);
+    if (!new_mem) {
+        return std::unexpected(new_mem.error());
+    }
+
+    // Copy old data to new memory, limited by the smaller of the two sizes
+    size_t copy_size = old_size < new_size ? old_size : new_size;
+    copy_bytes(new_mem.value(), old_ptr, copy_size);
+
+    return new_mem;
+}
+
+inline void GrowingLinearAllocator::destroy() {
+    arena.run_destructors(nullptr);
+
+    ArenaBlock* block = first_block;
+    while (block) {
+        ArenaBlock* next = block->next;
+        unpoison_memory(block->data(), block->capacity);
+        std::free(block);
+        block = next;
+    }
+
+    first_block = nullptr;
+    current_block = nullptr;
+    arena = LinearAllocator(nullptr, 0, arena.zero_on_alloc);
+}
+
+inline size_t GrowingLinearAllocator::total_capacity() const {
+    size_t total = 0;
+    for (ArenaBlock* block = first_block; block; block = block->next) {
+        total += block->capacity;
+    }
+    return total;
+}
+
+} // namespace alloc
@@ -4,15 +4,35 @@
 #include <cstdint>
 #include <cstddef>
 #include <expected>
+#include <span>
+#include <tuple>
+#include "AllocError.hpp"
+#include "ArenaDebug.hpp"
+#include "ArenaStats.hpp"
+#include "ArenaTrace.hpp"
+#include "MemoryKernels.hpp"
 
 namespace alloc {
 
 /**
- * @brief Error codes for the linear allocator
+ * @brief Size and alignment of one allocation in a batch
  */
-enum class AllocError {
-    OutOfMemory,      ///< Not enough memory in the allocator
-    InvalidAlignment  ///< Alignment is not a power of 2
+struct AllocRequest {
+    size_t size;      ///< Size in bytes
+    size_t alignment; ///< Alignment required (must be a power of 2)
+};
+
+/**
+ * @brief Entry of the in-arena list of objects whose destructors must run
+ *
+ * Nodes are allocated from the arena next to the objects they track, so the list
+ * costs nothing outside the arena and is freed together with it.
+ */
+struct DestructorNode {
+    void (*destroy)(void* objects, size_t count); ///< Destroys `count` objects in reverse order
+    void* objects;                                ///< First tracked object
+    size_t count;                                 ///< Number of fully constructed objects
+    DestructorNode* next;                         ///< Node registered before this one
 };
 
 /**
@@ -29,22 +49,37 @@ struct LinearAllocator {
     size_t capacity;    ///< Total capacity of the allocator in bytes
     size_t used;        ///< Current number of bytes used
     size_t prev_used;   ///< Offset of the previous allocation (for resize operations)
+    size_t known_zero_offset; ///< Memory at or past this offset has never been handed out and is zero
     bool zero_on_alloc; ///< Whether to zero memory on allocation
+    DestructorNode* destructors; ///< Most recently registered destructor, run first
+#ifdef LINEAR_ALLOCATOR_STATS
+    ArenaStats stats{}; ///< Allocation statistics, only present with LINEAR_ALLOCATOR_STATS
+#endif
+#ifdef LINEAR_ALLOCATOR_DEBUG
+    size_t last_guard = kNoGuard; ///< Newest guard record, only present with LINEAR_ALLOCATOR_DEBUG
+#endif
 
     /**
      * @brief Construct a new Linear Allocator
      *
+     * The contents of the buffer are unknown, so the known-zero watermark starts at
+     * the capacity. Factories that get zeroed memory lower it to 0.
+     *
      * @param buffer_ptr Pointer to the memory buffer
      * @param capacity_in_bytes Capacity of the allocator in bytes
      * @param zero_memory Whether to zero memory on allocation
      */
     LinearAllocator(uint8_t* buffer_ptr, size_t capacity_in_bytes, bool zero_memory = true)
         : buffer(buffer_ptr), capacity(capacity_in_bytes),
-          used(0), prev_used(0), zero_on_alloc(zero_memory) {}
+          used(0), prev_used(0), known_zero_offset(capacity_in_bytes),
+          zero_on_alloc(zero_memory), destructors(nullptr) {}
 
     /**
      * @brief Create a new Linear Allocator with a given capacity
      *
+     * When zeroing, the buffer comes from `calloc`, which can hand out fresh zero
+     * pages from the OS, and nothing is zeroed twice.
+     *
      * @param size_in_bytes The total size of the allocator in bytes
      * @param zero_memory Whether to zero memory on allocation
      * @return std::expected<LinearAllocator, AllocError> A new allocator or an error
@@ -55,6 +90,9 @@ struct LinearAllocator {
     /**
      * @brief Create a new Linear Allocator from an existing buffer
      *
+     * The buffer is not zeroed upfront; with `zero_memory` each allocation is zeroed
+     * when it is handed out.
+     *
      * @param buffer_ptr Pointer to the memory buffer
      * @param size_in_bytes The total size of the buffer in bytes
      * @param zero_memory Whether to zero memory on allocation
@@ -72,7 +110,8 @@ struct LinearAllocator {
      * @return std::expected<T*, AllocError> Pointer to the allocated memory or an error
      */
     template <typename T>
-    std::expected<T*, AllocError> allocate(size_t count = 1, size_t alignment = alignof(T));
+    std::expected<T*, AllocError> allocate(size_t count = 1, size_t alignment = alignof(T)
+                                           LINEAR_ALLOCATOR_CALLSITE_DECL);
 
     /**
      * @brief Allocate uninitialized memory with a specified alignment
@@ -82,7 +121,77 @@ struct LinearAllocator {
      * @return std::expected<void*, AllocError> Pointer to the allocated memory or an error
      */
     std::expected<void*, AllocError> allocate_bytes(size_t size_in_bytes,
-                                                   size_t alignment = alignof(std::max_align_t));
+                                                   size_t alignment = alignof(std::max_align_t)
+                                                   LINEAR_ALLOCATOR_CALLSITE_DECL);
+
+    /**
+     * @brief Allocate several blocks with one capacity check and one bump
+     *
+     * The layout of every request is computed first. Then the whole range is
+     * checked against the capacity once, zeroed in a single pass when zeroing is
+     * on, and claimed by one update of `used`. The last request becomes the last
+     * allocation, so it can be resized in place.
+     *
+     * @param requests Sizes and alignments, laid out in order
+     * @param out Receives one pointer per request, must hold at least requests.size() entries
+     * @return std::expected<void, AllocError> Nothing or an error. On error nothing is
+     *         allocated and `out` is not written; a too short `out` is OutOfMemory
+     */
+    std::expected<void, AllocError> allocate_batch(std::span<const AllocRequest> requests,
+                                                   std::span<void*> out);
+
+    /**
+     * @brief Allocate one array per type, `count` elements each, in a single bump
+     *
+     * Useful for struct-of-arrays layouts: `auto [xs, ys, ids] = allocate_soa<float, float, int>(n)`.
+     *
+     * @tparam Ts Element types of the arrays
+     * @param count Number of elements in every array
+     * @return std::expected<std::tuple<Ts*...>, AllocError> One pointer per array or an error
+     */
+    template <typename... Ts>
+    std::expected<std::tuple<Ts*...>, AllocError> allocate_soa(size_t count);
+
+    /**
+     * @brief Allocate and construct an object
+     *
+     * Trivially destructible types cost exactly one allocation. Other types also
+     * register a DestructorNode, so their destructor runs on reset() or when a
+     * TempArenaMemory savepoint taken before this call ends.
+     *
+     * @tparam T The type to construct
+     * @param args Arguments forwarded to the constructor
+     * @return std::expected<T*, AllocError> Pointer to the new object or an error
+     */
+    template <typename T, typename... Args>
+    std::expected<T*, AllocError> make(Args&&... args);
+
+    /**
+     * @brief Allocate and construct an array of objects
+     *
+     * Every element is constructed from the same arguments. Destructors are tracked
+     * as in make(); elements are destroyed in reverse order.
+     *
+     * @tparam T The type to construct
+     * @param count The number of elements
+     * @param args Arguments passed to every element's constructor
+     * @return std::expected<T*, AllocError> Pointer to the first element or an error
+     */
+    template <typename T, typename... Args>
+    std::expected<T*, AllocError> make_array(size_t count, const Args&... args);
+
+    /**
+     * @brief Run registered destructors, newest first, until `until` is the list head
+     *
+     * @param until List head to stop at, nullptr runs every destructor
+     */
+    void run_destructors(DestructorNode* until) {
+        while (destructors != until) {
+            DestructorNode* node = destructors;
+            destructors = node->next;
+            node->destroy(node->objects, node->count);
+        }
+    }
 
     /**
      * @brief Resize the last allocation made
@@ -101,17 +210,65 @@ struct LinearAllocator {
     template <typename T>
     std::expected<T*, AllocError> resize(T* old_ptr, size_t old_count,
                                          size_t new_count,
-                                         size_t alignment = alignof(T));
+                                         size_t alignment = alignof(T)
+                                         LINEAR_ALLOCATOR_CALLSITE_DECL);
+
+    /**
+     * @brief Zero the part of [begin, end) that lies below the known-zero watermark
+     *
+     * @param begin Offset of the first byte
+     * @param end Offset one past the last byte
+     */
+    void zero_dirty(size_t begin, size_t end);
 
     /**
      * @brief Reset the allocator, effectively freeing all allocations
      *
-     * This simply resets the used counters so the memory can be reused.
+     * Destructors registered by make() and make_array() run first, then the used
+     * counters are reset so the memory can be reused. In debug mode the guard
+     * zones are checked and the memory is filled and poisoned first.
      */
     void reset() {
+        run_destructors(nullptr);
+#ifdef LINEAR_ALLOCATOR_DEBUG
+        debug_release(0);
+#endif
+#ifdef LINEAR_ALLOCATOR_TRACE
+        trace_record(TraceKind::Reset, this, 0, 0, 0, true);
+#endif
         used = 0;
         prev_used = 0;
     }
+
+    /**
+     * @brief Check that no guard zone was overwritten, always true outside debug mode
+     *
+     * @param bad_offset Receives the offset of the first damaged byte, if not nullptr
+     * @return bool Whether every guard zone is intact
+     */
+    bool guards_intact(size_t* bad_offset = nullptr);
+
+    /**
+     * @brief Make the whole buffer addressable again before it is freed or reused
+     *
+     * Only does something in debug mode under AddressSanitizer. Buffers on the
+     * stack or reused for something else must be unpoisoned before that happens.
+     */
+    void unpoison() {
+        unpoison_memory(buffer, capacity);
+    }
+
+#ifdef LINEAR_ALLOCATOR_DEBUG
+    /**
+     * @brief Debug hook after [start, end) was handed out behind a guard zone at gap_begin
+     */
+    void debug_allocated(size_t gap_begin, size_t start, size_t end);
+
+    /**
+     * @brief Debug hook before [from, used) is given back: check guards, fill and poison
+     */
+    void debug_release(size_t from);
+#endif
 };
 
 /**
@@ -123,6 +280,8 @@ struct LinearAllocator {
 struct TempArenaMemory {
     LinearAllocator* allocator; ///< Pointer to the allocator
     size_t saved_used;          ///< The saved 'used' offset
+    size_t saved_prev_used;     ///< The saved 'prev_used' offset, so resize sees the same last allocation
+    DestructorNode* saved_destructors; ///< Destructor list head at the savepoint
 
     /**
      * @brief Create a temporary arena memory savepoint
@@ -131,15 +290,28 @@ struct TempArenaMemory {
      * @return TempArenaMemory A savepoint that can be used to roll back allocations
      */
     static TempArenaMemory begin(LinearAllocator& alloc) {
-        return TempArenaMemory{&alloc, alloc.used};
+#ifdef LINEAR_ALLOCATOR_TRACE
+        trace_record(TraceKind::TempBegin, &alloc, alloc.used, 0, 0, true);
+#endif
+        return TempArenaMemory{&alloc, alloc.used, alloc.prev_used, alloc.destructors};
     }
 
     /**
      * @brief End the temporary arena memory, rolling back any allocations made since creation
+     *
+     * Objects made since the savepoint are destroyed before their memory is given back.
      */
     void end() {
         if (allocator) {
+            allocator->run_destructors(saved_destructors);
+#ifdef LINEAR_ALLOCATOR_DEBUG
+            allocator->debug_release(saved_used);
+#endif
+#ifdef LINEAR_ALLOCATOR_TRACE
+            trace_record(TraceKind::TempEnd, allocator, saved_used, 0, 0, true);
+#endif
             allocator->used = saved_used;
+            allocator->prev_used = saved_prev_used;
             allocator = nullptr; // Mark as ended
         }
     }
@@ -154,6 +326,34 @@ struct TempArenaMemory {
     }
 };
 
+/**
+ * @brief Destroy `count` objects of type T, last one first
+ *
+ * @param objects Pointer to the first object
+ * @param count Number of objects
+ */
+template <typename T>
+void destroy_objects(void* objects, size_t count);
+
+/**
+ * @brief Allocate storage for `count` objects and, if T needs it, a destructor node
+ *
+ * The node is linked into `destructors` with a count of 0; callers raise the count
+ * as elements are constructed, so a throwing constructor leaves only finished
+ * elements to destroy. Shared by every arena that offers make().
+ *
+ * @tparam T The type to allocate for
+ * @tparam Arena An allocator with allocate<T>()
+ * @param arena The allocator to take memory from
+ * @param destructors Head of the arena's destructor list
+ * @param count Number of objects
+ * @param node Set to the registered node, or nullptr for trivially destructible types
+ * @return std::expected<T*, AllocError> Uninitialized storage or an error
+ */
+template <typename T, typename Arena>
+std::expected<T*, AllocError> allocate_tracked(Arena& arena, DestructorNode*& destructors,
+                                               size_t count, DestructorNode*& node);
+
 } // namespace alloc
 
 // Include template implementation
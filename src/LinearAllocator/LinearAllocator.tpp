@@ -3,6 +3,9 @@
 
 #include <cstdlib>
 #include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
 
 namespace alloc {
 
@@ -13,17 +16,18 @@ inline std::expected<LinearAllocator, AllocError> LinearAllocator::create(
         return std::unexpected(AllocError::OutOfMemory);
     }
 
-    uint8_t* mem = static_cast<uint8_t*>(std::malloc(size_in_bytes));
+    // calloc can hand out fresh zero pages without touching them
+    uint8_t* mem = static_cast<uint8_t*>(zero_memory ? std::calloc(size_in_bytes, 1)
+                                                     : std::malloc(size_in_bytes));
     if (!mem) {
         return std::unexpected(AllocError::OutOfMemory);
     }
 
-    // Zero the initial buffer if requested
+    LinearAllocator result(mem, size_in_bytes, zero_memory);
     if (zero_memory) {
-        std::memset(mem, 0, size_in_bytes);
+        result.known_zero_offset = 0;
     }
-
-    return LinearAllocator(mem, size_in_bytes, zero_memory);
+    return result;
 }
 
 inline std::expected<LinearAllocator, AllocError> LinearAllocator::create_from_buffer(
@@ -33,54 +37,202 @@ inline std::expected<LinearAllocator, AllocError> LinearAllocator::create_from_b
         return std::unexpected(AllocError::OutOfMemory);
     }
 
-    // Zero the buffer if requested
-    if (zero_memory) {
-        std::memset(buffer_ptr, 0, size_in_bytes);
-    }
-
+    // Nothing is zeroed upfront, allocations are zeroed as they are handed out
     return LinearAllocator(buffer_ptr, size_in_bytes, zero_memory);
 }
 
 inline std::expected<void*, AllocError> LinearAllocator::allocate_bytes(
-    size_t size_in_bytes, size_t alignment) {
+    size_t size_in_bytes, size_t alignment LINEAR_ALLOCATOR_CALLSITE_PARAM) {
 
     // Ensure alignment is a power of 2
     if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
         return std::unexpected(AllocError::InvalidAlignment);
     }
 
-    // Calculate aligned address
+    // Calculate aligned address, leaving room for a guard zone in debug mode
     uintptr_t current = reinterpret_cast<uintptr_t>(buffer + used);
-    uintptr_t aligned = (current + alignment - 1) & ~(alignment - 1);
+    uintptr_t aligned = (current + kRedzoneBytes + alignment - 1) & ~(alignment - 1);
     size_t adjustment = aligned - current;
 
     // Check if we have enough space
     if (used + adjustment + size_in_bytes > capacity) {
+#ifdef LINEAR_ALLOCATOR_STATS
+        stats.out_of_memory++;
+#endif
+#ifdef LINEAR_ALLOCATOR_TRACE
+        trace_record(TraceKind::Allocate, this, size_in_bytes, capacity, alignment, false);
+#endif
         return std::unexpected(AllocError::OutOfMemory);
     }
 
     // Get the result pointer and update the used counter
     prev_used = used + adjustment; // Track prev_used for resize
     void* result = buffer + prev_used;
+#ifdef LINEAR_ALLOCATOR_DEBUG
+    debug_allocated(used, prev_used, prev_used + size_in_bytes);
+#endif
     used = prev_used + size_in_bytes;
 
-    // Zero the memory if requested
-    if (zero_on_alloc && size_in_bytes > 0) {
-        std::memset(result, 0, size_in_bytes);
+    // Zero the memory if requested, skipping memory that was never handed out
+    if (zero_on_alloc) {
+        zero_dirty(prev_used, used);
+    }
+    if (used > known_zero_offset) {
+        known_zero_offset = used;
     }
 
+#ifdef LINEAR_ALLOCATOR_STATS
+    stats.record_allocation(size_in_bytes, adjustment, used);
+#endif
+#ifdef LINEAR_ALLOCATOR_CALLSITES
+    stats.record_call_site(callsite, size_in_bytes);
+#endif
+#ifdef LINEAR_ALLOCATOR_TRACE
+    trace_record(TraceKind::Allocate, this, size_in_bytes, capacity, alignment, true);
+#endif
+
     return result;
 }
 
+inline std::expected<void, AllocError> LinearAllocator::allocate_batch(
+    std::span<const AllocRequest> requests, std::span<void*> out) {
+
+    if (requests.empty()) {
+        return {};
+    }
+    if (out.size() < requests.size()) {
+        return std::unexpected(AllocError::OutOfMemory);
+    }
+
+    // Lay out every request from the current offset without touching the allocator or `out`
+    uintptr_t base = reinterpret_cast<uintptr_t>(buffer);
+    size_t begin = used;
+    size_t offset = used;
+    size_t last_offset = used;
+    bool fits = true;
+    for (size_t i = 0; i < requests.size(); i++) {
+        size_t alignment = requests[i].alignment;
+        if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+            return std::unexpected(AllocError::InvalidAlignment);
+        }
+        if (!fits) {
+            continue;
+        }
+
+        // Every step is checked on its own, so huge sizes cannot wrap around past the capacity
+        uintptr_t current = base + offset + kRedzoneBytes;
+        if (alignment - 1 > UINTPTR_MAX - current) {
+            fits = false;
+            continue;
+        }
+        last_offset = ((current + alignment - 1) & ~(alignment - 1)) - base;
+        if (last_offset > capacity || requests[i].size > capacity - last_offset) {
+            fits = false;
+            continue;
+        }
+        offset = last_offset + requests[i].size;
+    }
+
+    // One capacity check for the whole batch
+    if (!fits) {
+#ifdef LINEAR_ALLOCATOR_STATS
+        stats.out_of_memory++;
+#endif
+#ifdef LINEAR_ALLOCATOR_TRACE
+        for (const AllocRequest& request : requests) {
+            trace_record(TraceKind::Allocate, this, request.size, capacity, request.alignment, false);
+        }
+#endif
+        return std::unexpected(AllocError::OutOfMemory);
+    }
+
+    // The batch fits, hand out the pointers
+    size_t position = begin;
+    for (size_t i = 0; i < requests.size(); i++) {
+        size_t alignment = requests[i].alignment;
+        size_t start = ((base + position + kRedzoneBytes + alignment - 1) & ~(alignment - 1)) - base;
+        out[i] = buffer + start;
+        position = start + requests[i].size;
+    }
+
+    prev_used = last_offset;
+    used = offset;
+
+    // One pass over the whole range, padding included
+#ifdef LINEAR_ALLOCATOR_DEBUG
+    unpoison_memory(buffer + begin, used - begin);
+#endif
+    if (zero_on_alloc) {
+        zero_dirty(begin, used);
+    }
+#ifdef LINEAR_ALLOCATOR_DEBUG
+    size_t gap_begin = begin;
+    for (size_t i = 0; i < requests.size(); i++) {
+        size_t start = static_cast<size_t>(static_cast<uint8_t*>(out[i]) - buffer);
+        debug_allocated(gap_begin, start, start + requests[i].size);
+        gap_begin = start + requests[i].size;
+    }
+#endif
+    if (used > known_zero_offset) {
+        known_zero_offset = used;
+    }
+
+#ifdef LINEAR_ALLOCATOR_STATS
+    size_t previous_end = begin;
+    for (size_t i = 0; i < requests.size(); i++) {
+        size_t start = static_cast<size_t>(static_cast<uint8_t*>(out[i]) - buffer);
+        stats.record_allocation(requests[i].size, start - previous_end, start + requests[i].size);
+        previous_end = start + requests[i].size;
+    }
+#endif
+#ifdef LINEAR_ALLOCATOR_TRACE
+    for (const AllocRequest& request : requests) {
+        trace_record(TraceKind::Allocate, this, request.size, capacity, request.alignment, true);
+    }
+#endif
+
+    return {};
+}
+
+template <typename... Ts>
+inline std::expected<std::tuple<Ts*...>, AllocError> LinearAllocator::allocate_soa(size_t count) {
+    static_assert(sizeof...(Ts) > 0, "allocate_soa needs at least one array type");
+
+    if (((count > SIZE_MAX / sizeof(Ts)) || ...)) {
+        return std::unexpected(AllocError::OutOfMemory);
+    }
+
+    AllocRequest requests[] = {AllocRequest{count * sizeof(Ts), alignof(Ts)}...};
+    void* pointers[sizeof...(Ts)];
+
+    auto result = allocate_batch(requests, pointers);
+    if (!result) {
+        return std::unexpected(result.error());
+    }
+
+    return [&]<size_t... Is>(std::index_sequence<Is...>) {
+        return std::tuple<Ts*...>{static_cast<Ts*>(pointers[Is])...};
+    }(std::index_sequence_for<Ts...>{});
+}
+
+inline void LinearAllocator::zero_dirty(size_t begin, size_t end) {
+    if (end > known_zero_offset) {
+        end = known_zero_offset;
+    }
+    if (begin < end) {
+        zero_bytes(buffer + begin, end - begin);
+    }
+}
+
 template <typename T>
 inline std::expected<T*, AllocError> LinearAllocator::allocate(
-    size_t count, size_t alignment) {
+    size_t count, size_t alignment LINEAR_ALLOCATOR_CALLSITE_PARAM) {
 
     if (count == 0) {
         return static_cast<T*>(nullptr);
     }
 
-    auto result = allocate_bytes(count * sizeof(T), alignment);
+    auto result = allocate_bytes(count * sizeof(T), alignment LINEAR_ALLOCATOR_CALLSITE_ARG);
     if (!result) {
         return std::unexpected(result.error());
     }
@@ -88,12 +240,122 @@ inline std::expected<T*, AllocError> LinearAllocator::allocate(
     return static_cast<T*>(result.value());
 }
 
+inline bool LinearAllocator::guards_intact(size_t* bad_offset) {
+#ifdef LINEAR_ALLOCATOR_DEBUG
+    size_t offset = kNoGuard;
+    bool intact = check_guards(buffer, last_guard, offset);
+    if (!intact && bad_offset) {
+        *bad_offset = offset;
+    }
+    return intact;
+#else
+    (void)bad_offset;
+    return true;
+#endif
+}
+
+#ifdef LINEAR_ALLOCATOR_DEBUG
+inline void LinearAllocator::debug_allocated(size_t gap_begin, size_t start, size_t end) {
+    unpoison_memory(buffer + start, end - start);
+    write_guard(buffer, gap_begin, start, last_guard);
+#if LINEAR_ALLOCATOR_DEBUG_FILL
+    if (!zero_on_alloc) {
+        std::memset(buffer + start, kAllocatedPattern, end - start);
+    }
+#endif
+}
+
+inline void LinearAllocator::debug_release(size_t from) {
+    size_t bad_offset = kNoGuard;
+    if (!check_guards(buffer, last_guard, bad_offset)) {
+        report_guard_corruption(buffer, bad_offset);
+    }
+    drop_guards(buffer, last_guard, from);
+
+    if (used > from) {
+#if LINEAR_ALLOCATOR_DEBUG_FILL
+        unpoison_memory(buffer + from, used - from);
+        std::memset(buffer + from, kFreedPattern, used - from);
+#endif
+        poison_memory(buffer + from, used - from);
+    }
+}
+#endif
+
+template <typename T>
+inline void destroy_objects(void* objects, size_t count) {
+    T* typed = static_cast<T*>(objects);
+    while (count > 0) {
+        typed[--count].~T();
+    }
+}
+
+template <typename T, typename Arena>
+inline std::expected<T*, AllocError> allocate_tracked(Arena& arena, DestructorNode*& destructors,
+                                                      size_t count, DestructorNode*& node) {
+    node = nullptr;
+
+    auto storage = arena.template allocate<T>(count);
+    if (!storage) {
+        return std::unexpected(storage.error());
+    }
+
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        auto tracked = arena.template allocate<DestructorNode>();
+        if (!tracked) {
+            return std::unexpected(tracked.error());
+        }
+        node = tracked.value();
+        *node = DestructorNode{&destroy_objects<T>, storage.value(), 0, destructors};
+        destructors = node;
+    }
+
+    return storage;
+}
+
+template <typename T, typename... Args>
+inline std::expected<T*, AllocError> LinearAllocator::make(Args&&... args) {
+    DestructorNode* node;
+    auto storage = allocate_tracked<T>(*this, destructors, 1, node);
+    if (!storage) {
+        return storage;
+    }
+
+    T* object = new (storage.value()) T(std::forward<Args>(args)...);
+    if (node) {
+        node->count = 1;
+    }
+    return object;
+}
+
+template <typename T, typename... Args>
+inline std::expected<T*, AllocError> LinearAllocator::make_array(size_t count, const Args&... args) {
+    if (count == 0) {
+        return static_cast<T*>(nullptr);
+    }
+
+    DestructorNode* node;
+    auto storage = allocate_tracked<T>(*this, destructors, count, node);
+    if (!storage) {
+        return storage;
+    }
+
+    T* objects = storage.value();
+    for (size_t i = 0; i < count; i++) {
+        new (objects + i) T(args...);
+        if (node) {
+            node->count = i + 1;
+        }
+    }
+    return objects;
+}
+
 template <typename T>
 inline std::expected<T*, AllocError> LinearAllocator::resize(
-    T* old_ptr, size_t old_count, size_t new_count, size_t alignment) {
+    T* old_ptr, size_t old_count, size_t new_count, size_t alignment LINEAR_ALLOCATOR_CALLSITE_PARAM) {
 
     if (!old_ptr || old_count == 0) {
-        return allocate<T>(new_count, alignment);
+        return allocate<T>(new_count, alignment LINEAR_ALLOCATOR_CALLSITE_ARG);
     }
 
     size_t old_size = old_count * sizeof(T);
@@ -107,30 +369,54 @@ inline std::expected<T*, AllocError> LinearAllocator::resize(
     if (old_offset == prev_used) {
         // This was the last allocation, we can resize in place
         if (prev_used + new_size <= capacity) {
+#ifdef LINEAR_ALLOCATOR_DEBUG
+            if (prev_used + new_size < used) {
+                debug_release(prev_used + new_size);
+            } else {
+                unpoison_memory(buffer + used, prev_used + new_size - used);
+            }
+#endif
             used = prev_used + new_size;
 
             // Zero any new memory if expanding
             if (zero_on_alloc && new_size > old_size) {
-                std::memset(
-                    reinterpret_cast<uint8_t*>(old_ptr) + old_size,
-                    0,
-                    new_size - old_size
-                );
+                zero_dirty(prev_used + old_size, used);
+            }
+            if (used > known_zero_offset) {
+                known_zero_offset = used;
             }
 
+#ifdef LINEAR_ALLOCATOR_STATS
+            stats.resizes_in_place++;
+            if (used > stats.high_water_mark) {
+                stats.high_water_mark = used;
+            }
+#endif
+#ifdef LINEAR_ALLOCATOR_TRACE
+            trace_record(TraceKind::Resize, this, new_size, old_size, alignment, true);
+#endif
             return old_ptr;
         }
+#ifdef LINEAR_ALLOCATOR_STATS
+        stats.out_of_memory++;
+#endif
+#ifdef LINEAR_ALLOCATOR_TRACE
+        trace_record(TraceKind::Resize, this, new_size, old_size, alignment, false);
+#endif
         return std::unexpected(AllocError::OutOfMemory);
     } else {
+#ifdef LINEAR_ALLOCATOR_STATS
+        stats.resizes_copied++;
+#endif
         // Not the last allocation, allocate new memory and copy
-        auto new_mem = allocate<T>(new_count, alignment);
+        auto new_mem = allocate<T>(new_count, alignment LINEAR_ALLOCATOR_CALLSITE_ARG);
         if (!new_mem) {
             return std::unexpected(new_mem.error());
         }
 
         // Copy old data to new memory, limited by the smaller of the two sizes
         size_t copy_size = old_size < new_size ? old_size : new_size;
-        std::memcpy(new_mem.value(), old_ptr, copy_size);
+        copy_bytes(new_mem.value(), old_ptr, copy_size);
 
         return new_mem;
     }
@@ -0,0 +1,72 @@
+// src/LinearAllocator/MemoryKernels.hpp
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * Blocks of at least this many bytes are zeroed and copied with non-temporal
+ * stores, which bypass the cache. Smaller blocks are likely to be used soon and
+ * go through memset/memcpy. The default sits above common L2 sizes; run the
+ * memory_kernels benchmark and set the CMake option of the same name to tune
+ * it. Every translation unit must see the same value, so do not define it
+ * per file before including.
+ */
+#ifndef LINEAR_ALLOCATOR_NT_THRESHOLD
+#define LINEAR_ALLOCATOR_NT_THRESHOLD (size_t(4) << 20)
+#endif
+
+namespace alloc {
+
+/**
+ * @brief Instruction set used by the non-temporal kernels
+ */
+enum class KernelIsa {
+    Portable, ///< memset/memcpy only
+    SSE2,     ///< 16-byte non-temporal stores (every x86-64 CPU)
+    AVX2,     ///< 32-byte non-temporal stores
+    AVX512    ///< 64-byte non-temporal stores
+};
+
+/**
+ * @brief Non-temporal kernels selected for the running CPU
+ */
+struct MemoryKernels {
+    KernelIsa isa;                                          ///< Instruction set in use
+    void (*zero)(void* dst, size_t size);                   ///< Non-temporal zero
+    void (*copy)(void* dst, const void* src, size_t size);  ///< Non-temporal copy
+};
+
+/**
+ * @brief Pick the widest kernels the CPU supports (AVX-512, AVX2, SSE2, portable)
+ */
+MemoryKernels select_memory_kernels();
+
+/**
+ * @brief Kernels for this CPU, selected once on first use
+ */
+const MemoryKernels& memory_kernels();
+
+/**
+ * @brief Zero memory, with non-temporal stores from LINEAR_ALLOCATOR_NT_THRESHOLD bytes on
+ *
+ * @param dst Memory to zero
+ * @param size Number of bytes
+ */
+void zero_bytes(void* dst, size_t size);
+
+/**
+ * @brief Copy memory, with non-temporal stores from LINEAR_ALLOCATOR_NT_THRESHOLD bytes on
+ *
+ * The ranges must not overlap.
+ *
+ * @param dst Destination
+ * @param src Source
+ * @param size Number of bytes
+ */
+void copy_bytes(void* dst, const void* src, size_t size);
+
+} // namespace alloc
+
+// Include template implementation
+#include "MemoryKernels.tpp"
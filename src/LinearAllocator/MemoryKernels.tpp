@@ -0,0 +1,205 @@
+// src/LinearAllocator/MemoryKernels.tpp
+#pragma once
+
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define LINEAR_ALLOCATOR_X86_KERNELS 1
+#endif
+
+namespace alloc {
+
+#ifdef LINEAR_ALLOCATOR_X86_KERNELS
+
+/**
+ * @brief Bytes needed to bring `dst` up to a multiple of `alignment`
+ */
+inline size_t bytes_to_alignment(const void* dst, size_t alignment) {
+    return (alignment - (reinterpret_cast<uintptr_t>(dst) & (alignment - 1))) & (alignment - 1);
+}
+
+// Every kernel stores the unaligned head and the tail with memset/memcpy and
+// streams the aligned middle, then fences so the stores are ordered before
+// the memory is handed out.
+
+inline void zero_nt_sse2(void* dst, size_t size) {
+    uint8_t* out = static_cast<uint8_t*>(dst);
+    size_t head = bytes_to_alignment(out, 16);
+    head = head < size ? head : size;
+    std::memset(out, 0, head);
+    out += head;
+    size -= head;
+
+    __m128i zero = _mm_setzero_si128();
+    for (; size >= 64; size -= 64, out += 64) {
+        _mm_stream_si128(reinterpret_cast<__m128i*>(out), zero);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(out + 16), zero);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(out + 32), zero);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(out + 48), zero);
+    }
+    _mm_sfence();
+    std::memset(out, 0, size);
+}
+
+inline void copy_nt_sse2(void* dst, const void* src, size_t size) {
+    uint8_t* out = static_cast<uint8_t*>(dst);
+    const uint8_t* in = static_cast<const uint8_t*>(src);
+    size_t head = bytes_to_alignment(out, 16);
+    head = head < size ? head : size;
+    std::memcpy(out, in, head);
+    out += head;
+    in += head;
+    size -= head;
+
+    for (; size >= 64; size -= 64, out += 64, in += 64) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 16));
+        __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 32));
+        __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 48));
+        _mm_stream_si128(reinterpret_cast<__m128i*>(out), a);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(out + 16), b);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(out + 32), c);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(out + 48), d);
+    }
+    _mm_sfence();
+    std::memcpy(out, in, size);
+}
+
+__attribute__((target("avx2")))
+inline void zero_nt_avx2(void* dst, size_t size) {
+    uint8_t* out = static_cast<uint8_t*>(dst);
+    size_t head = bytes_to_alignment(out, 32);
+    head = head < size ? head : size;
+    std::memset(out, 0, head);
+    out += head;
+    size -= head;
+
+    __m256i zero = _mm256_setzero_si256();
+    for (; size >= 128; size -= 128, out += 128) {
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(out), zero);
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(out + 32), zero);
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(out + 64), zero);
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(out + 96), zero);
+    }
+    _mm_sfence();
+    std::memset(out, 0, size);
+}
+
+__attribute__((target("avx2")))
+inline void copy_nt_avx2(void* dst, const void* src, size_t size) {
+    uint8_t* out = static_cast<uint8_t*>(dst);
+    const uint8_t* in = static_cast<const uint8_t*>(src);
+    size_t head = bytes_to_alignment(out, 32);
+    head = head < size ? head : size;
+    std::memcpy(out, in, head);
+    out += head;
+    in += head;
+    size -= head;
+
+    for (; size >= 128; size -= 128, out += 128, in += 128) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + 32));
+        __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + 64));
+        __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + 96));
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(out), a);
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(out + 32), b);
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(out + 64), c);
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(out + 96), d);
+    }
+    _mm_sfence();
+    std::memcpy(out, in, size);
+}
+
+__attribute__((target("avx512f")))
+inline void zero_nt_avx512(void* dst, size_t size) {
+    uint8_t* out = static_cast<uint8_t*>(dst);
+    size_t head = bytes_to_alignment(out, 64);
+    head = head < size ? head : size;
+    std::memset(out, 0, head);
+    out += head;
+    size -= head;
+
+    __m512i zero = _mm512_setzero_si512();
+    for (; size >= 256; size -= 256, out += 256) {
+        _mm512_stream_si512(reinterpret_cast<__m512i*>(out), zero);
+        _mm512_stream_si512(reinterpret_cast<__m512i*>(out + 64), zero);
+        _mm512_stream_si512(reinterpret_cast<__m512i*>(out + 128), zero);
+        _mm512_stream_si512(reinterpret_cast<__m512i*>(out + 192), zero);
+    }
+    _mm_sfence();
+    std::memset(out, 0, size);
+}
+
+__attribute__((target("avx512f")))
+inline void copy_nt_avx512(void* dst, const void* src, size_t size) {
+    uint8_t* out = static_cast<uint8_t*>(dst);
+    const uint8_t* in = static_cast<const uint8_t*>(src);
+    size_t head = bytes_to_alignment(out, 64);
+    head = head < size ? head : size;
+    std::memcpy(out, in, head);
+    out += head;
+    in += head;
+    size -= head;
+
+    for (; size >= 256; size -= 256, out += 256, in += 256) {
+        __m512i a = _mm512_loadu_si512(in);
+        __m512i b = _mm512_loadu_si512(in + 64);
+        __m512i c = _mm512_loadu_si512(in + 128);
+        __m512i d = _mm512_loadu_si512(in + 192);
+        _mm512_stream_si512(reinterpret_cast<__m512i*>(out), a);
+        _mm512_stream_si512(reinterpret_cast<__m512i*>(out + 64), b);
+        _mm512_stream_si512(reinterpret_cast<__m512i*>(out + 128), c);
+        _mm512_stream_si512(reinterpret_cast<__m512i*>(out + 192), d);
+    }
+    _mm_sfence();
+    std::memcpy(out, in, size);
+}
+
+#endif // LINEAR_ALLOCATOR_X86_KERNELS
+
+inline void zero_portable(void* dst, size_t size) {
+    std::memset(dst, 0, size);
+}
+
+inline void copy_portable(void* dst, const void* src, size_t size) {
+    std::memcpy(dst, src, size);
+}
+
+inline MemoryKernels select_memory_kernels() {
+#ifdef LINEAR_ALLOCATOR_X86_KERNELS
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return MemoryKernels{KernelIsa::AVX512, &zero_nt_avx512, &copy_nt_avx512};
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return MemoryKernels{KernelIsa::AVX2, &zero_nt_avx2, &copy_nt_avx2};
+    }
+    return MemoryKernels{KernelIsa::SSE2, &zero_nt_sse2, &copy_nt_sse2};
+#else
+    return MemoryKernels{KernelIsa::Portable, &zero_portable, &copy_portable};
+#endif
+}
+
+inline const MemoryKernels& memory_kernels() {
+    static const MemoryKernels kernels = select_memory_kernels();
+    return kernels;
+}
+
+inline void zero_bytes(void* dst, size_t size) {
+    if (size < LINEAR_ALLOCATOR_NT_THRESHOLD) {
+        std::memset(dst, 0, size);
+        return;
+    }
+    memory_kernels().zero(dst, size);
+}
+
+inline void copy_bytes(void* dst, const void* src, size_t size) {
+    if (size < LINEAR_ALLOCATOR_NT_THRESHOLD) {
+        std::memcpy(dst, src, size);
+        return;
+    }
+    memory_kernels().copy(dst, src, size);
+}
+
+} // namespace alloc
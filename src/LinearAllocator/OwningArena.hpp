@@ -0,0 +1,219 @@
+// src/LinearAllocator/OwningArena.hpp
+#pragma once
+
+#include "LinearAllocator.hpp"
+#include "ArenaPlacement.hpp"
+
+namespace alloc {
+
+/**
+ * @brief Where an OwningArena gets its memory from and how it gives it back
+ *
+ * A pair of callbacks and a context pointer, so sources can be swapped without
+ * templates. The context must outlive every arena using the source.
+ */
+struct BackingSource {
+    /// Get at least `size` bytes, `size` is raised to what was actually obtained;
+    /// sets `zeroed` when the memory is known to read as zero
+    std::expected<uint8_t*, AllocError> (*acquire)(void* context, size_t& size, bool& zeroed);
+    /// Give back memory obtained from acquire() with the size it reported
+    void (*release)(void* context, uint8_t* memory, size_t size);
+    void* context; ///< Passed to both callbacks
+    size_t limit;  ///< Largest size the source can provide, SIZE_MAX when unbounded
+};
+
+/**
+ * @brief Memory from calloc / malloc, freed with free
+ */
+BackingSource malloc_backing();
+
+/**
+ * @brief Memory from an anonymous mapping, unmapped on release (POSIX only)
+ *
+ * @param placement Huge page and NUMA placement, must outlive the arenas using the source
+ */
+BackingSource mmap_backing(const PlacementOptions* placement = nullptr);
+
+/**
+ * @brief A caller-owned buffer that is never freed; it backs one arena at a time
+ *
+ * The arena takes the whole buffer whatever size it asks for.
+ *
+ * @param buffer The caller's buffer, must outlive the arena
+ * @param size_in_bytes Size of the buffer
+ */
+BackingSource buffer_backing(uint8_t* buffer, size_t size_in_bytes);
+
+/**
+ * @brief Memory carved from a parent arena, reclaimed when the parent resets or rolls back
+ *
+ * @param parent The arena to carve from
+ */
+BackingSource parent_backing(LinearAllocator& parent);
+
+/**
+ * @brief A LinearAllocator that owns its memory and gives it back in its destructor
+ *
+ * Move-only: moving transfers the memory and leaves the moved-from arena empty,
+ * so two arenas never give back one buffer. Destructors registered with make() run before
+ * the memory is released.
+ */
+struct OwningArena {
+    LinearAllocator arena; ///< Allocator over the owned memory
+    BackingSource source;  ///< Where the memory came from
+
+    /**
+     * @brief An empty arena that owns nothing
+     */
+    OwningArena() : arena(nullptr, 0), source{nullptr, nullptr, nullptr, 0} {}
+
+    OwningArena(const OwningArena&) = delete;
+    OwningArena& operator=(const OwningArena&) = delete;
+
+    OwningArena(OwningArena&& other) noexcept : arena(other.arena), source(other.source) {
+        other.arena = LinearAllocator(nullptr, 0, other.arena.zero_on_alloc);
+    }
+
+    OwningArena& operator=(OwningArena&& other) noexcept {
+        if (this != &other) {
+            release();
+            arena = other.arena;
+            source = other.source;
+            other.arena = LinearAllocator(nullptr, 0, other.arena.zero_on_alloc);
+        }
+        return *this;
+    }
+
+    ~OwningArena() {
+        release();
+    }
+
+    /**
+     * @brief Create an arena with memory from a backing source
+     *
+     * @param size_in_bytes The total size of the allocator in bytes, the source may round it up
+     * @param zero_memory Whether to zero memory on allocation
+     * @param backing Where the memory comes from
+     * @return std::expected<OwningArena, AllocError> A new arena or an error
+     */
+    static std::expected<OwningArena, AllocError> create(size_t size_in_bytes, bool zero_memory = true,
+                                                         BackingSource backing = malloc_backing());
+
+    /**
+     * @brief Allocate memory, see LinearAllocator::allocate
+     */
+    template <typename T>
+    std::expected<T*, AllocError> allocate(size_t count = 1, size_t alignment = alignof(T)
+                                           LINEAR_ALLOCATOR_CALLSITE_DECL) {
+        return arena.allocate<T>(count, alignment LINEAR_ALLOCATOR_CALLSITE_ARG);
+    }
+
+    /**
+     * @brief Allocate uninitialized memory, see LinearAllocator::allocate_bytes
+     */
+    std::expected<void*, AllocError> allocate_bytes(size_t size_in_bytes,
+                                                   size_t alignment = alignof(std::max_align_t)
+                                                   LINEAR_ALLOCATOR_CALLSITE_DECL) {
+        return arena.allocate_bytes(size_in_bytes, alignment LINEAR_ALLOCATOR_CALLSITE_ARG);
+    }
+
+    /**
+     * @brief Allocate and construct an object, see LinearAllocator::make
+     */
+    template <typename T, typename... Args>
+    std::expected<T*, AllocError> make(Args&&... args) {
+        return arena.make<T>(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Resize an allocation, see LinearAllocator::resize
+     */
+    template <typename T>
+    std::expected<T*, AllocError> resize(T* old_ptr, size_t old_count, size_t new_count,
+                                         size_t alignment = alignof(T)
+                                         LINEAR_ALLOCATOR_CALLSITE_DECL) {
+        return arena.resize<T>(old_ptr, old_count, new_count, alignment LINEAR_ALLOCATOR_CALLSITE_ARG);
+    }
+
+    /**
+     * @brief Reset the allocator, keeping the memory
+     */
+    void reset() {
+        arena.reset();
+    }
+
+    /**
+     * @brief Run registered destructors and give the memory back to its source
+     */
+    void release();
+
+    /**
+     * @brief Whether the arena owns memory
+     */
+    explicit operator bool() const { return arena.buffer != nullptr; }
+};
+
+/**
+ * @brief Keeps released arena buffers of one size on a free list for reuse
+ *
+ * backing() is a BackingSource: arenas created from it take a cached buffer if
+ * one is free, and their destructor puts the buffer back instead of freeing it.
+ * Requests of another size go straight to the upstream source. Not thread-safe;
+ * use one recycler per thread.
+ */
+struct ArenaRecycler {
+    /**
+     * @brief Free list entry, stored in the first bytes of a cached buffer
+     */
+    struct CachedBuffer {
+        CachedBuffer* next; ///< Next cached buffer
+    };
+
+    BackingSource upstream; ///< Where new buffers come from and excess ones go
+    size_t buffer_size;     ///< Size of the buffers that are cached
+    size_t granted_size;    ///< What upstream really provides for `buffer_size`, after rounding
+    size_t max_cached;      ///< Buffers beyond this many are released upstream
+    size_t cached;          ///< Number of buffers on the free list
+    CachedBuffer* free_list; ///< Most recently released buffer
+
+    /**
+     * @brief Create a recycler for buffers of one size
+     *
+     * @param size_in_bytes Size of the arenas that are recycled
+     * @param max_cached_buffers Most buffers kept on the free list
+     * @param upstream_source Where buffers come from when the free list is empty
+     */
+    ArenaRecycler(size_t size_in_bytes, size_t max_cached_buffers = 64,
+                  BackingSource upstream_source = malloc_backing())
+        : upstream(upstream_source), buffer_size(size_in_bytes), granted_size(size_in_bytes),
+          max_cached(max_cached_buffers), cached(0), free_list(nullptr) {}
+
+    ArenaRecycler(const ArenaRecycler&) = delete;
+    ArenaRecycler& operator=(const ArenaRecycler&) = delete;
+
+    ~ArenaRecycler() {
+        trim(0);
+    }
+
+    /**
+     * @brief The source to create recycled arenas from, valid while the recycler lives
+     */
+    BackingSource backing();
+
+    /**
+     * @brief Create an arena of `buffer_size` bytes, reusing a cached buffer if there is one
+     */
+    std::expected<OwningArena, AllocError> acquire(bool zero_memory = true) {
+        return OwningArena::create(buffer_size, zero_memory, backing());
+    }
+
+    /**
+     * @brief Release cached buffers upstream until at most `keep` remain
+     */
+    void trim(size_t keep);
+};
+
+} // namespace alloc
+
+// Include template implementation
+#include "OwningArena.tpp"
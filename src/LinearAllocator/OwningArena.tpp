@@ -0,0 +1,151 @@
+// src/LinearAllocator/OwningArena.tpp
+#pragma once
+
+#include <cstdint>
+#include <cstdlib>
+
+namespace alloc {
+
+inline BackingSource malloc_backing() {
+    auto acquire = [](void*, size_t& size, bool& zeroed) -> std::expected<uint8_t*, AllocError> {
+        // calloc can hand out fresh zero pages without touching them
+        uint8_t* mem = static_cast<uint8_t*>(std::calloc(size, 1));
+        if (!mem) {
+            return std::unexpected(AllocError::OutOfMemory);
+        }
+        zeroed = true;
+        return mem;
+    };
+    auto release = [](void*, uint8_t* memory, size_t) {
+        std::free(memory);
+    };
+    return BackingSource{acquire, release, nullptr, SIZE_MAX};
+}
+
+inline BackingSource mmap_backing(const PlacementOptions* placement) {
+    auto acquire = [](void* context, size_t& size, bool& zeroed) -> std::expected<uint8_t*, AllocError> {
+        static const PlacementOptions defaults{};
+        const PlacementOptions* options = context ? static_cast<const PlacementOptions*>(context)
+                                                  : &defaults;
+        auto region = map_region(size, *options, true);
+        if (!region) {
+            return std::unexpected(region.error());
+        }
+        // Anonymous mappings start zeroed and the whole rounded length is usable
+        size = region->size;
+        zeroed = true;
+        return region->base;
+    };
+    auto release = [](void*, uint8_t* memory, size_t size) {
+        unmap_region(MappedRegion{memory, size, false, false});
+    };
+    return BackingSource{acquire, release, const_cast<PlacementOptions*>(placement), SIZE_MAX};
+}
+
+inline BackingSource buffer_backing(uint8_t* buffer, size_t size_in_bytes) {
+    auto acquire = [](void* context, size_t&, bool& zeroed) -> std::expected<uint8_t*, AllocError> {
+        // create() has already raised the size to the limit
+        zeroed = false;
+        return static_cast<uint8_t*>(context);
+    };
+    auto release = [](void*, uint8_t*, size_t) {};
+    return BackingSource{acquire, release, buffer, size_in_bytes};
+}
+
+inline BackingSource parent_backing(LinearAllocator& parent) {
+    auto acquire = [](void* context, size_t& size, bool& zeroed) -> std::expected<uint8_t*, AllocError> {
+        auto* arena = static_cast<LinearAllocator*>(context);
+        auto mem = arena->allocate_bytes(size, alignof(std::max_align_t));
+        if (!mem) {
+            return std::unexpected(mem.error());
+        }
+        zeroed = arena->zero_on_alloc;
+        return static_cast<uint8_t*>(mem.value());
+    };
+    // The parent takes the memory back when it resets or rolls back
+    auto release = [](void*, uint8_t*, size_t) {};
+    return BackingSource{acquire, release, &parent, SIZE_MAX};
+}
+
+inline std::expected<OwningArena, AllocError> OwningArena::create(size_t size_in_bytes, bool zero_memory,
+                                                                  BackingSource backing) {
+    if (size_in_bytes == 0 || size_in_bytes > backing.limit || !backing.acquire) {
+        return std::unexpected(AllocError::OutOfMemory);
+    }
+
+    // Sources with a fixed buffer hand all of it over
+    size_t size = backing.limit != SIZE_MAX ? backing.limit : size_in_bytes;
+    bool zeroed = false;
+    auto mem = backing.acquire(backing.context, size, zeroed);
+    if (!mem) {
+        return std::unexpected(mem.error());
+    }
+
+    OwningArena result;
+    result.arena = LinearAllocator(mem.value(), size, zero_memory);
+    if (zeroed) {
+        result.arena.known_zero_offset = 0;
+    }
+    result.source = backing;
+    return result;
+}
+
+inline void OwningArena::release() {
+    if (!arena.buffer) {
+        return;
+    }
+
+    arena.run_destructors(nullptr);
+    arena.unpoison();
+    if (source.release) {
+        source.release(source.context, arena.buffer, arena.capacity);
+    }
+    arena = LinearAllocator(nullptr, 0, arena.zero_on_alloc);
+}
+
+inline BackingSource ArenaRecycler::backing() {
+    auto acquire = [](void* context, size_t& size, bool& zeroed) -> std::expected<uint8_t*, AllocError> {
+        auto* recycler = static_cast<ArenaRecycler*>(context);
+        bool cacheable = size == recycler->buffer_size || size == recycler->granted_size;
+
+        if (cacheable && recycler->free_list) {
+            CachedBuffer* cached_buffer = recycler->free_list;
+            recycler->free_list = cached_buffer->next;
+            recycler->cached--;
+            size = recycler->granted_size;
+            zeroed = false; // Recycled buffers hold whatever the last arena left
+            return reinterpret_cast<uint8_t*>(cached_buffer);
+        }
+
+        auto mem = recycler->upstream.acquire(recycler->upstream.context, size, zeroed);
+        if (mem && cacheable) {
+            recycler->granted_size = size;
+        }
+        return mem;
+    };
+    auto release = [](void* context, uint8_t* memory, size_t size) {
+        auto* recycler = static_cast<ArenaRecycler*>(context);
+        if (size != recycler->granted_size || size < sizeof(CachedBuffer) ||
+            recycler->cached >= recycler->max_cached) {
+            recycler->upstream.release(recycler->upstream.context, memory, size);
+            return;
+        }
+
+        auto* cached_buffer = reinterpret_cast<CachedBuffer*>(memory);
+        cached_buffer->next = recycler->free_list;
+        recycler->free_list = cached_buffer;
+        recycler->cached++;
+    };
+    return BackingSource{acquire, release, this, upstream.limit};
+}
+
+inline void ArenaRecycler::trim(size_t keep) {
+    while (cached > keep) {
+        CachedBuffer* cached_buffer = free_list;
+        free_list = cached_buffer->next;
+        cached--;
+        upstream.release(upstream.context, reinterpret_cast<uint8_t*>(cached_buffer), granted_size);
+    }
+}
+
+} // namespace alloc
@@ -0,0 +1,209 @@
+// src/LinearAllocator/PersistentArena.hpp
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+#include "LinearAllocator.hpp"
+
+namespace alloc {
+
+/**
+ * @brief A pointer stored as an offset from its own address
+ *
+ * The target is found by adding the offset to `this`, so a structure made of
+ * rel_ptrs stays valid wherever the memory holding it is mapped, as long as the
+ * rel_ptr and its target move together. An offset of 0 is the null pointer, so a
+ * rel_ptr cannot point at itself.
+ *
+ * Copying a rel_ptr recomputes the offset for the new location.
+ *
+ * @tparam T The type pointed to
+ */
+template <typename T>
+struct rel_ptr {
+    int64_t offset; ///< Distance in bytes from this rel_ptr to the target, 0 for null
+
+    rel_ptr() : offset(0) {}
+    rel_ptr(T* target) : offset(0) { set(target); }
+    rel_ptr(const rel_ptr& other) : offset(0) { set(other.get()); }
+
+    rel_ptr& operator=(const rel_ptr& other) {
+        set(other.get());
+        return *this;
+    }
+
+    rel_ptr& operator=(T* target) {
+        set(target);
+        return *this;
+    }
+
+    /**
+     * @brief Point at `target`, or at nothing if it is nullptr
+     */
+    void set(T* target) {
+        offset = target ? reinterpret_cast<intptr_t>(target) - reinterpret_cast<intptr_t>(this) : 0;
+    }
+
+    /**
+     * @brief The target as a regular pointer, valid for the current mapping only
+     */
+    T* get() const {
+        if (offset == 0) {
+            return nullptr;
+        }
+        return reinterpret_cast<T*>(reinterpret_cast<intptr_t>(this) + offset);
+    }
+
+    T* operator->() const { return get(); }
+    T& operator*() const { return *get(); }
+    T& operator[](size_t index) const { return get()[index]; }
+    explicit operator bool() const { return offset != 0; }
+};
+
+/**
+ * @brief Header at the start of a persistent arena file
+ */
+struct PersistentArenaHeader {
+    uint64_t magic;       ///< kPersistentArenaMagic, identifies the file format
+    uint32_t version;     ///< Layout version of the file
+    uint32_t header_size; ///< Offset of the data area in the file
+    uint64_t capacity;    ///< Size of the data area in bytes
+    uint64_t used;        ///< Bytes in use at the last sync()
+    uint64_t root;        ///< Offset in the data area of the root object plus 1, 0 for none
+};
+
+inline constexpr uint64_t kPersistentArenaMagic = 0x414E4552414E494Cull; ///< "LINARENA" in little-endian byte order
+inline constexpr uint32_t kPersistentArenaVersion = 1;
+inline constexpr size_t kPersistentArenaHeaderSize = 64; ///< Keeps the data area cache-line aligned
+static_assert(sizeof(PersistentArenaHeader) <= kPersistentArenaHeaderSize);
+
+/**
+ * @brief A linear allocator backed by a memory-mapped file that survives the process (POSIX only)
+ *
+ * The file holds a PersistentArenaHeader followed by the data area. Opening an
+ * existing file maps it and restores `used` and the root object from the header,
+ * so structures built in a previous run are usable immediately without parsing
+ * or copying. Pointers inside the arena must be rel_ptrs, since the file is not
+ * mapped at the same address every time.
+ *
+ * sync() is the checkpoint: it writes `used` and the root to the header and
+ * flushes the mapping with msync. A file opened after a crash comes back with the
+ * `used` and root of the last sync, and data allocated after it is ignored. The
+ * checkpointed bytes themselves are only safe while they are not reused: after
+ * reset(), new allocations overwrite them in the shared mapping, and the kernel
+ * may write those pages to the file before the next sync().
+ *
+ * Only plain data and rel_ptrs should be stored: nothing is constructed or
+ * destroyed when the file is opened or closed.
+ */
+struct PersistentArena {
+    LinearAllocator arena;         ///< Allocator over the data area of the mapping
+    PersistentArenaHeader* header; ///< Header at the start of the mapping
+    size_t mapped_size;            ///< Length of the mapping in bytes
+    uint64_t root_offset;          ///< Root written to the header at the next sync(), see set_root()
+    int fd;                        ///< Descriptor of the backing file
+    bool restored;                 ///< Whether the contents were restored from an existing file
+
+    /**
+     * @brief Open or create a persistent arena file
+     *
+     * An existing file with a valid header is mapped as is and keeps its own
+     * capacity. A missing or empty file is sized to hold a header and
+     * `capacity_in_bytes` of data. Any other file is left untouched.
+     *
+     * @param path Path of the backing file
+     * @param capacity_in_bytes Capacity of the data area when the file is created
+     * @param zero_memory Whether to zero memory on allocation
+     * @return std::expected<PersistentArena, AllocError> The arena, or FileError if the
+     *         file cannot be opened or is not a valid persistent arena
+     */
+    static std::expected<PersistentArena, AllocError> create_from_file(
+        const char* path, size_t capacity_in_bytes, bool zero_memory = true);
+
+    /**
+     * @brief Allocate memory with a specified alignment
+     *
+     * @tparam T The type to allocate for, must be trivially destructible
+     * @param count The number of elements to allocate
+     * @param alignment The alignment required (must be a power of 2, at most the page size)
+     * @return std::expected<T*, AllocError> Pointer to the allocated memory or an error
+     */
+    template <typename T>
+    std::expected<T*, AllocError> allocate(size_t count = 1, size_t alignment = alignof(T)
+                                           LINEAR_ALLOCATOR_CALLSITE_DECL) {
+        static_assert(std::is_trivially_destructible_v<T>,
+                      "PersistentArena never destroys objects");
+        return arena.allocate<T>(count, alignment LINEAR_ALLOCATOR_CALLSITE_ARG);
+    }
+
+    /**
+     * @brief Allocate uninitialized memory with a specified alignment
+     */
+    std::expected<void*, AllocError> allocate_bytes(size_t size_in_bytes,
+                                                   size_t alignment = alignof(std::max_align_t)
+                                                   LINEAR_ALLOCATOR_CALLSITE_DECL) {
+        return arena.allocate_bytes(size_in_bytes, alignment LINEAR_ALLOCATOR_CALLSITE_ARG);
+    }
+
+    /**
+     * @brief Resize the last allocation in place, or allocate and copy, see LinearAllocator::resize
+     *
+     * A moved block is copied bytewise, which would break the rel_ptrs inside it,
+     * so only trivially copyable types can be resized.
+     */
+    template <typename T>
+    std::expected<T*, AllocError> resize(T* old_ptr, size_t old_count, size_t new_count,
+                                         size_t alignment = alignof(T)
+                                         LINEAR_ALLOCATOR_CALLSITE_DECL) {
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "A moved block is copied bytewise, which breaks rel_ptrs");
+        return arena.resize<T>(old_ptr, old_count, new_count, alignment LINEAR_ALLOCATOR_CALLSITE_ARG);
+    }
+
+    /**
+     * @brief Set the object later runs start from, stored in the header at the next sync()
+     *
+     * @param object Pointer into the arena, or nullptr to clear the root
+     */
+    void set_root(const void* object) {
+        root_offset = object ? static_cast<uint64_t>(static_cast<const uint8_t*>(object) - arena.buffer) + 1
+                             : 0;
+    }
+
+    /**
+     * @brief The root object stored by set_root() in this or a previous run
+     */
+    template <typename T>
+    T* root() const {
+        return root_offset ? reinterpret_cast<T*>(arena.buffer + root_offset - 1) : nullptr;
+    }
+
+    /**
+     * @brief Checkpoint: store `used` and the root in the header and flush the mapping to the file
+     *
+     * Only the header and the used part of the data area are flushed.
+     *
+     * @return std::expected<void, AllocError> Nothing, or FileError if msync failed
+     */
+    std::expected<void, AllocError> sync();
+
+    /**
+     * @brief Forget every allocation and the root; takes effect in the file at the next sync()
+     *
+     * Until then the last checkpoint is only intact as long as nothing is allocated.
+     */
+    void reset() {
+        arena.reset();
+        root_offset = 0;
+    }
+
+    /**
+     * @brief Unmap the file and close it without syncing
+     */
+    void destroy();
+};
+
+} // namespace alloc
+
+// Include template implementation
+#include "PersistentArena.tpp"
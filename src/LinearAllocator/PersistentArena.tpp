@@ -0,0 +1,129 @@
+// src/LinearAllocator/PersistentArena.tpp
+#pragma once
+
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace alloc {
+
+inline std::expected<PersistentArena, AllocError> PersistentArena::create_from_file(
+    const char* path, size_t capacity_in_bytes, bool zero_memory) {
+
+    // Only a file created here or an empty one is ever given a fresh header
+    bool created = true;
+    int fd = open(path, O_RDWR | O_CREAT | O_EXCL, 0644);
+    if (fd < 0 && errno == EEXIST) {
+        created = false;
+        fd = open(path, O_RDWR);
+    }
+    if (fd < 0) {
+        return std::unexpected(AllocError::FileError);
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        close(fd);
+        return std::unexpected(AllocError::FileError);
+    }
+
+    // Read the header of an existing file before deciding how much to map
+    PersistentArenaHeader existing{};
+    bool restored = !created && info.st_size != 0;
+    if (restored) {
+        bool valid = static_cast<size_t>(info.st_size) >= kPersistentArenaHeaderSize &&
+                     pread(fd, &existing, sizeof(existing), 0) == sizeof(existing) &&
+                     existing.magic == kPersistentArenaMagic &&
+                     existing.version == kPersistentArenaVersion &&
+                     existing.header_size == kPersistentArenaHeaderSize &&
+                     existing.used <= existing.capacity &&
+                     existing.root <= existing.used &&
+                     static_cast<uint64_t>(info.st_size) >= kPersistentArenaHeaderSize + existing.capacity;
+
+        // A mistyped path, a newer format or a partly written file is left untouched
+        if (!valid) {
+            close(fd);
+            return std::unexpected(AllocError::FileError);
+        }
+    }
+
+    size_t capacity = restored ? static_cast<size_t>(existing.capacity) : capacity_in_bytes;
+    if (capacity == 0) {
+        close(fd);
+        return std::unexpected(AllocError::OutOfMemory);
+    }
+
+    // A new file is extended to size, so its data area reads as zero
+    size_t mapped_size = kPersistentArenaHeaderSize + capacity;
+    if (!restored && ftruncate(fd, static_cast<off_t>(mapped_size)) != 0) {
+        close(fd);
+        if (created) {
+            unlink(path);
+        }
+        return std::unexpected(AllocError::FileError);
+    }
+
+    void* mem = mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (mem == MAP_FAILED) {
+        close(fd);
+        return std::unexpected(AllocError::FileError);
+    }
+
+    uint8_t* base = static_cast<uint8_t*>(mem);
+    auto* header = reinterpret_cast<PersistentArenaHeader*>(base);
+    if (!restored) {
+        *header = PersistentArenaHeader{kPersistentArenaMagic, kPersistentArenaVersion,
+                                        static_cast<uint32_t>(kPersistentArenaHeaderSize),
+                                        capacity, 0, 0};
+    }
+
+    PersistentArena result{
+        LinearAllocator(base + kPersistentArenaHeaderSize, capacity, zero_memory),
+        header,
+        mapped_size,
+        header->root,
+        fd,
+        restored
+    };
+
+    // Memory past a restored `used` may hold data from after the last sync
+    result.arena.used = static_cast<size_t>(header->used);
+    result.arena.prev_used = result.arena.used;
+    if (!restored) {
+        result.arena.known_zero_offset = 0;
+    }
+    return result;
+}
+
+inline std::expected<void, AllocError> PersistentArena::sync() {
+    // Flush the data before the header that makes it reachable, so a crash in
+    // between leaves the previous checkpoint intact
+    if (msync(header, kPersistentArenaHeaderSize + arena.used, MS_SYNC) != 0) {
+        return std::unexpected(AllocError::FileError);
+    }
+
+    header->used = arena.used;
+    header->root = root_offset;
+    if (msync(header, kPersistentArenaHeaderSize, MS_SYNC) != 0) {
+        return std::unexpected(AllocError::FileError);
+    }
+    return {};
+}
+
+inline void PersistentArena::destroy() {
+    if (header) {
+        arena.unpoison();
+        munmap(header, mapped_size);
+    }
+    if (fd >= 0) {
+        close(fd);
+    }
+    arena = LinearAllocator(nullptr, 0, arena.zero_on_alloc);
+    header = nullptr;
+    mapped_size = 0;
+    fd = -1;
+}
+
+} // namespace alloc
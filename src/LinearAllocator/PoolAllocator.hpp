@@ -0,0 +1,199 @@
+// src/LinearAllocator/PoolAllocator.hpp
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <expected>
+#include <utility>
+#include "LinearAllocator.hpp"
+
+namespace alloc {
+
+struct PoolAllocator;
+
+/**
+ * @brief A free chunk, linked through its own first bytes
+ */
+struct PoolFreeChunk {
+    PoolFreeChunk* next; ///< Next free chunk
+};
+
+/**
+ * @brief Header of a slab carved from the parent arena
+ *
+ * A DestructorNode for the slab is registered in the parent, so resetting the
+ * parent or rolling back past the slab tells the owning pool to forget it.
+ */
+struct PoolSlab {
+    PoolAllocator* owner; ///< Pool using the slab, nullptr once the pool is gone
+    PoolSlab* next;       ///< Slab carved before this one
+    uint8_t* chunks;      ///< First chunk
+    size_t bytes;         ///< Bytes of chunk memory in the slab
+};
+
+/**
+ * @brief A fixed-size pool allocator whose slabs are carved from a LinearAllocator
+ *
+ * Chunks are handed out and freed in O(1) through an intrusive free list. Slabs are
+ * taken from the parent arena on demand and carved lazily, one chunk at a time.
+ * Every slab registers a callback in the parent's destructor list: when the parent
+ * resets or a TempArenaMemory savepoint taken before the slab ends, the pool drops
+ * the slab and its free chunks, so it never hands out memory the parent reclaimed.
+ *
+ * The pool registers its own address with the parent, so it cannot be copied or
+ * moved, and it must be destroyed before the parent's buffer is freed. Recycled
+ * chunks are not zeroed.
+ */
+struct PoolAllocator {
+    LinearAllocator* parent;  ///< Arena the slabs are carved from
+    size_t chunk_size;        ///< Size of every chunk in bytes, a multiple of the alignment
+    size_t chunk_alignment;   ///< Alignment of every chunk
+    size_t chunks_per_slab;   ///< Number of chunks taken from the parent at a time
+    PoolFreeChunk* free_list; ///< Chunks that were freed
+    PoolSlab* slabs;          ///< Most recently carved slab
+    uint8_t* carve_next;      ///< Next never-used chunk in the newest slab
+    uint8_t* carve_end;       ///< End of the newest slab's chunks
+
+    /**
+     * @brief Create a pool, nothing is taken from the parent until the first allocation
+     *
+     * @param parent_arena Arena to carve slabs from
+     * @param size Size of every chunk, raised to hold a pointer and rounded to the alignment
+     * @param alignment Alignment of every chunk (must be a power of 2)
+     * @param slab_chunks Number of chunks per slab
+     */
+    PoolAllocator(LinearAllocator& parent_arena, size_t size,
+                  size_t alignment = alignof(std::max_align_t), size_t slab_chunks = 64);
+
+    PoolAllocator(const PoolAllocator&) = delete;
+    PoolAllocator& operator=(const PoolAllocator&) = delete;
+
+    /**
+     * @brief Detach the slabs, their memory stays in the parent until it resets
+     */
+    ~PoolAllocator();
+
+    /**
+     * @brief Allocate one chunk
+     *
+     * @return std::expected<void*, AllocError> Pointer to the chunk or an error
+     */
+    std::expected<void*, AllocError> allocate() {
+        if (free_list) {
+            PoolFreeChunk* chunk = free_list;
+            free_list = chunk->next;
+            return chunk;
+        }
+        if (carve_next != carve_end) {
+            void* chunk = carve_next;
+            carve_next += chunk_size;
+            return chunk;
+        }
+        return allocate_from_new_slab();
+    }
+
+    /**
+     * @brief Give a chunk back to the pool
+     *
+     * @param ptr Chunk returned by allocate(), nullptr does nothing
+     */
+    void free(void* ptr) {
+        if (!ptr) {
+            return;
+        }
+        PoolFreeChunk* chunk = static_cast<PoolFreeChunk*>(ptr);
+        chunk->next = free_list;
+        free_list = chunk;
+    }
+
+    /**
+     * @brief Allocate a chunk and construct an object in it
+     *
+     * @tparam T The type to construct, must fit in a chunk
+     * @param args Arguments forwarded to the constructor
+     * @return std::expected<T*, AllocError> Pointer to the new object or an error
+     */
+    template <typename T, typename... Args>
+    std::expected<T*, AllocError> make(Args&&... args);
+
+    /**
+     * @brief Destroy an object made by make() and free its chunk
+     */
+    template <typename T>
+    void destroy(T* object);
+
+    /**
+     * @brief Slow path of allocate(): carve a new slab from the parent
+     */
+    std::expected<void*, AllocError> allocate_from_new_slab();
+
+    /**
+     * @brief Forget a slab whose memory the parent reclaimed
+     */
+    void drop_slab(PoolSlab* slab);
+
+    /**
+     * @brief Destructor-list callback registered for every slab
+     */
+    static void release_slab(void* slab, size_t count);
+};
+
+/**
+ * @brief Power-of-2 size classes, each served by its own PoolAllocator
+ *
+ * Requests up to kMaxClassSize bytes go to the smallest class that fits; larger ones
+ * are allocated from the parent directly and are only reclaimed when it resets.
+ *
+ * @tparam kClassCount Number of classes, from 16 bytes doubling upwards
+ */
+template <size_t kClassCount = 8>
+struct SizeClassPool {
+    static constexpr size_t kMinClassSize = 16; ///< Chunk size of the smallest class
+    static constexpr size_t kMaxClassSize = kMinClassSize << (kClassCount - 1); ///< Chunk size of the largest class
+
+    LinearAllocator* parent;         ///< Arena the classes carve from
+    PoolAllocator classes[kClassCount]; ///< Class i holds chunks of kMinClassSize << i bytes
+
+    /**
+     * @brief Create the size classes, all carving slabs from the same parent
+     *
+     * @param parent_arena Arena to carve slabs from
+     * @param slab_chunks Number of chunks per slab in every class
+     */
+    explicit SizeClassPool(LinearAllocator& parent_arena, size_t slab_chunks = 64)
+        : SizeClassPool(parent_arena, slab_chunks, std::make_index_sequence<kClassCount>{}) {}
+
+    /**
+     * @brief Index of the class serving a size, kClassCount if no class fits
+     */
+    static size_t class_index(size_t size_in_bytes);
+
+    /**
+     * @brief Allocate memory from the smallest class that fits
+     *
+     * @param size_in_bytes Requested size
+     * @return std::expected<void*, AllocError> Pointer to the memory or an error
+     */
+    std::expected<void*, AllocError> allocate_bytes(size_t size_in_bytes LINEAR_ALLOCATOR_CALLSITE_DECL);
+
+    /**
+     * @brief Free memory from allocate_bytes()
+     *
+     * @param ptr Pointer to the memory, nullptr does nothing
+     * @param size_in_bytes The size passed to allocate_bytes()
+     */
+    void free(void* ptr, size_t size_in_bytes);
+
+    /**
+     * @brief Construct class i with chunks of kMinClassSize << i bytes
+     */
+    template <size_t... Is>
+    SizeClassPool(LinearAllocator& parent_arena, size_t slab_chunks, std::index_sequence<Is...>)
+        : parent(&parent_arena),
+          classes{PoolAllocator(parent_arena, kMinClassSize << Is, alignof(std::max_align_t), slab_chunks)...} {}
+};
+
+} // namespace alloc
+
+// Include template implementation
+#include "PoolAllocator.tpp"
@@ -0,0 +1,146 @@
+// src/LinearAllocator/PoolAllocator.tpp
+#pragma once
+
+#include <bit>
+#include <new>
+
+namespace alloc {
+
+inline PoolAllocator::PoolAllocator(LinearAllocator& parent_arena, size_t size,
+                                    size_t alignment, size_t slab_chunks)
+    : parent(&parent_arena), chunk_size(size), chunk_alignment(alignment),
+      chunks_per_slab(slab_chunks == 0 ? 1 : slab_chunks), free_list(nullptr),
+      slabs(nullptr), carve_next(nullptr), carve_end(nullptr) {
+
+    // A free chunk stores the list link in place
+    if (chunk_alignment < alignof(PoolFreeChunk)) {
+        chunk_alignment = alignof(PoolFreeChunk);
+    }
+    if (chunk_size < sizeof(PoolFreeChunk)) {
+        chunk_size = sizeof(PoolFreeChunk);
+    }
+    chunk_size = (chunk_size + chunk_alignment - 1) & ~(chunk_alignment - 1);
+}
+
+inline PoolAllocator::~PoolAllocator() {
+    for (PoolSlab* slab = slabs; slab; slab = slab->next) {
+        slab->owner = nullptr;
+    }
+}
+
+inline std::expected<void*, AllocError> PoolAllocator::allocate_from_new_slab() {
+    // Slab header, its destructor node and the chunks in one bump of the parent
+    AllocRequest requests[] = {
+        {sizeof(PoolSlab), alignof(PoolSlab)},
+        {sizeof(DestructorNode), alignof(DestructorNode)},
+        {chunk_size * chunks_per_slab, chunk_alignment},
+    };
+    void* pointers[3];
+
+    auto carved = parent->allocate_batch(requests, pointers);
+    if (!carved) {
+        return std::unexpected(carved.error());
+    }
+
+    PoolSlab* slab = static_cast<PoolSlab*>(pointers[0]);
+    *slab = PoolSlab{this, slabs, static_cast<uint8_t*>(pointers[2]), chunk_size * chunks_per_slab};
+    slabs = slab;
+
+    DestructorNode* node = static_cast<DestructorNode*>(pointers[1]);
+    *node = DestructorNode{&PoolAllocator::release_slab, slab, 1, parent->destructors};
+    parent->destructors = node;
+
+    carve_next = slab->chunks + chunk_size;
+    carve_end = slab->chunks + slab->bytes;
+    return slab->chunks;
+}
+
+inline void PoolAllocator::drop_slab(PoolSlab* slab) {
+    uint8_t* begin = slab->chunks;
+    uint8_t* end = slab->chunks + slab->bytes;
+
+    // Unlink free chunks that live in the slab
+    PoolFreeChunk** link = &free_list;
+    while (*link) {
+        uint8_t* chunk = reinterpret_cast<uint8_t*>(*link);
+        if (chunk >= begin && chunk < end) {
+            *link = (*link)->next;
+        } else {
+            link = &(*link)->next;
+        }
+    }
+
+    if (carve_end == end) {
+        carve_next = nullptr;
+        carve_end = nullptr;
+    }
+
+    for (PoolSlab** entry = &slabs; *entry; entry = &(*entry)->next) {
+        if (*entry == slab) {
+            *entry = slab->next;
+            break;
+        }
+    }
+}
+
+inline void PoolAllocator::release_slab(void* slab, size_t) {
+    PoolSlab* released = static_cast<PoolSlab*>(slab);
+    if (released->owner) {
+        released->owner->drop_slab(released);
+    }
+}
+
+template <typename T, typename... Args>
+inline std::expected<T*, AllocError> PoolAllocator::make(Args&&... args) {
+    if (sizeof(T) > chunk_size) {
+        return std::unexpected(AllocError::OutOfMemory);
+    }
+    if (alignof(T) > chunk_alignment) {
+        return std::unexpected(AllocError::InvalidAlignment);
+    }
+
+    auto chunk = allocate();
+    if (!chunk) {
+        return std::unexpected(chunk.error());
+    }
+    return new (chunk.value()) T(std::forward<Args>(args)...);
+}
+
+template <typename T>
+inline void PoolAllocator::destroy(T* object) {
+    if (object) {
+        object->~T();
+        free(object);
+    }
+}
+
+template <size_t kClassCount>
+inline size_t SizeClassPool<kClassCount>::class_index(size_t size_in_bytes) {
+    if (size_in_bytes <= kMinClassSize) {
+        return 0;
+    }
+    if (size_in_bytes > kMaxClassSize) {
+        return kClassCount;
+    }
+    return static_cast<size_t>(std::bit_width((size_in_bytes - 1) / kMinClassSize));
+}
+
+template <size_t kClassCount>
+inline std::expected<void*, AllocError> SizeClassPool<kClassCount>::allocate_bytes(
+    size_t size_in_bytes LINEAR_ALLOCATOR_CALLSITE_PARAM) {
+    size_t index = class_index(size_in_bytes);
+    if (index == kClassCount) {
+        return parent->allocate_bytes(size_in_bytes, alignof(std::max_align_t) LINEAR_ALLOCATOR_CALLSITE_ARG);
+    }
+    return classes[index].allocate();
+}
+
+template <size_t kClassCount>
+inline void SizeClassPool<kClassCount>::free(void* ptr, size_t size_in_bytes) {
+    size_t index = class_index(size_in_bytes);
+    if (index < kClassCount) {
+        classes[index].free(ptr);
+    }
+}
+
+} // namespace alloc
@@ -0,0 +1,88 @@
+// src/LinearAllocator/ScratchArena.hpp
+#pragma once
+
+#include <initializer_list>
+#include "OwningArena.hpp"
+
+#ifndef LINEAR_ALLOCATOR_SCRATCH_COUNT
+#define LINEAR_ALLOCATOR_SCRATCH_COUNT 2 ///< Scratch arenas per thread, at least 2
+#endif
+
+#ifndef LINEAR_ALLOCATOR_SCRATCH_BYTES
+#define LINEAR_ALLOCATOR_SCRATCH_BYTES (size_t(8) * 1024 * 1024) ///< Capacity of every scratch arena
+#endif
+
+namespace alloc {
+
+inline constexpr size_t kScratchArenaCount = LINEAR_ALLOCATOR_SCRATCH_COUNT;
+inline constexpr size_t kScratchArenaBytes = LINEAR_ALLOCATOR_SCRATCH_BYTES;
+static_assert(kScratchArenaCount >= 2, "One scratch arena cannot avoid a conflicting caller");
+
+/**
+ * @brief A scope of temporary memory on one of the calling thread's scratch arenas
+ *
+ * Everything allocated through it is given back, and the arena's full state is
+ * restored, when the scope ends. Move-only, so a scope is ended exactly once.
+ */
+struct ScratchArena {
+    TempArenaMemory temp; ///< Savepoint on the scratch arena, restored when the scope ends
+
+    /**
+     * @brief Open a scope on an arena
+     */
+    explicit ScratchArena(LinearAllocator& scratch) : temp(TempArenaMemory::begin(scratch)) {}
+
+    ScratchArena(const ScratchArena&) = delete;
+    ScratchArena& operator=(const ScratchArena&) = delete;
+
+    ScratchArena(ScratchArena&& other) noexcept : temp(other.temp) {
+        other.temp.allocator = nullptr;
+    }
+
+    ScratchArena& operator=(ScratchArena&&) = delete;
+
+    /**
+     * @brief The scratch arena, valid until the scope ends
+     */
+    LinearAllocator& arena() const { return *temp.allocator; }
+
+    /**
+     * @brief Allocate from the scratch arena, see LinearAllocator::allocate
+     */
+    template <typename T>
+    std::expected<T*, AllocError> allocate(size_t count = 1, size_t alignment = alignof(T)) {
+        return temp.allocator->allocate<T>(count, alignment);
+    }
+
+    /**
+     * @brief Give back everything allocated in the scope now instead of at destruction
+     */
+    void end() {
+        temp.end();
+    }
+};
+
+/**
+ * @brief Open a scratch scope on a thread-local arena that none of the conflicts use
+ *
+ * A function that builds its result in an arena passes that arena as a conflict,
+ * so its temporaries never land between the result allocations. Scopes on the same
+ * arena must end in reverse order of creation, which nested calls do naturally.
+ * The arenas are created on first use and freed when the thread exits.
+ *
+ * @param conflicts Arenas the caller is still allocating results in
+ * @return std::expected<ScratchArena, AllocError> A scope, or OutOfMemory when every
+ *         scratch arena conflicts or one could not be created
+ */
+std::expected<ScratchArena, AllocError> get_scratch(
+    std::initializer_list<const LinearAllocator*> conflicts = {});
+
+/**
+ * @brief The calling thread's scratch arenas, created on first use
+ */
+OwningArena* thread_scratch_arenas();
+
+} // namespace alloc
+
+// Include template implementation
+#include "ScratchArena.tpp"
@@ -0,0 +1,39 @@
+// src/LinearAllocator/ScratchArena.tpp
+#pragma once
+
+#include <array>
+
+namespace alloc {
+
+inline OwningArena* thread_scratch_arenas() {
+    thread_local std::array<OwningArena, kScratchArenaCount> arenas;
+    return arenas.data();
+}
+
+inline std::expected<ScratchArena, AllocError> get_scratch(
+    std::initializer_list<const LinearAllocator*> conflicts) {
+
+    OwningArena* arenas = thread_scratch_arenas();
+    for (size_t i = 0; i < kScratchArenaCount; i++) {
+        bool in_use = false;
+        for (const LinearAllocator* conflict : conflicts) {
+            in_use = in_use || conflict == &arenas[i].arena;
+        }
+        if (in_use) {
+            continue;
+        }
+
+        if (!arenas[i]) {
+            // Scratch memory is uninitialized, like the heap memory it replaces
+            auto created = OwningArena::create(kScratchArenaBytes, false);
+            if (!created) {
+                return std::unexpected(created.error());
+            }
+            arenas[i] = std::move(created.value());
+        }
+        return ScratchArena(arenas[i].arena);
+    }
+    return std::unexpected(AllocError::OutOfMemory);
+}
+
+} // namespace alloc
@@ -0,0 +1,124 @@
+// src/LinearAllocator/SegregatedArena.hpp
+#pragma once
+
+#include <array>
+#include "LinearAllocator.hpp"
+
+namespace alloc {
+
+/**
+ * @brief Front-end that keeps allocations of each alignment in their own sub-arena
+ *
+ * Interleaving 1-byte and 64-byte aligned requests in one arena loses up to 63
+ * bytes of padding per request. Here every power-of-two alignment up to 64 has a
+ * bucket: a LinearAllocator over a chunk carved from the parent, so requests of
+ * one alignment sit back to back. Requests of `large_threshold` bytes or more,
+ * or aligned to more than 64, go straight to the parent, so a chunk is never
+ * wasted on one big block. So does a request whose bucket is full when the
+ * parent has no room left for another chunk.
+ *
+ * The buckets only hold views into the parent. reset() and SegregatedSavepoint
+ * roll the parent back, giving every bucket's memory back at once. Objects with
+ * destructors are not supported; use the parent's make() for those.
+ */
+struct SegregatedArena {
+    static constexpr size_t kBucketCount = 7;          ///< Alignments 1, 2, 4, 8, 16, 32 and 64
+    static constexpr size_t kMaxBucketAlignment = 64;  ///< Largest alignment served by a bucket
+
+    LinearAllocator* parent; ///< Arena the chunks are carved from
+    size_t chunk_size;       ///< Bytes carved from the parent when a bucket runs out
+    size_t large_threshold;  ///< Requests at least this large go straight to the parent
+    size_t base_used;        ///< Parent offset when the arena was created, reset() returns to it
+    size_t base_prev_used;   ///< Parent prev_used when the arena was created
+    DestructorNode* base_destructors; ///< Parent destructor list head when the arena was created
+    std::array<LinearAllocator, kBucketCount> buckets; ///< Current chunk of every alignment
+
+    /**
+     * @brief Create a segregated front-end over a parent arena
+     *
+     * @param parent_arena The arena to carve chunks from, must outlive this one
+     * @param chunk_bytes Bytes carved per bucket refill
+     * @param large_bytes Requests at least this large bypass the buckets, at most half a chunk
+     */
+    explicit SegregatedArena(LinearAllocator& parent_arena, size_t chunk_bytes = 16 * 1024,
+                             size_t large_bytes = 512);
+
+    /**
+     * @brief Allocate uninitialized memory from the bucket of its alignment
+     *
+     * @param size_in_bytes The size to allocate in bytes
+     * @param alignment The alignment required (must be a power of 2)
+     * @return std::expected<void*, AllocError> Pointer to the allocated memory or an error
+     */
+    std::expected<void*, AllocError> allocate_bytes(size_t size_in_bytes,
+                                                   size_t alignment = alignof(std::max_align_t)
+                                                   LINEAR_ALLOCATOR_CALLSITE_DECL);
+
+    /**
+     * @brief Allocate memory for `count` objects of type T
+     *
+     * @tparam T The type to allocate for
+     * @param count The number of elements to allocate
+     * @param alignment The alignment required (must be a power of 2)
+     * @return std::expected<T*, AllocError> Pointer to the allocated memory or an error
+     */
+    template <typename T>
+    std::expected<T*, AllocError> allocate(size_t count = 1, size_t alignment = alignof(T)
+                                           LINEAR_ALLOCATOR_CALLSITE_DECL);
+
+    /**
+     * @brief Give back everything allocated through this arena and empty every bucket
+     *
+     * The parent rolls back to where it was when this arena was created.
+     */
+    void reset();
+
+    /**
+     * @brief Bytes of the parent used by this arena, including unused chunk tails
+     */
+    size_t footprint() const {
+        return parent->used - base_used;
+    }
+};
+
+/**
+ * @brief Savepoint across the parent and every bucket of a SegregatedArena
+ *
+ * Chunks carved after the savepoint are given back by the parent; buckets go back
+ * to the chunk and offset they had.
+ */
+struct SegregatedSavepoint {
+    SegregatedArena* arena;         ///< Arena the savepoint belongs to
+    TempArenaMemory parent_savepoint; ///< Savepoint of the parent
+    std::array<LinearAllocator, SegregatedArena::kBucketCount> saved_buckets; ///< Buckets at the savepoint
+
+    /**
+     * @brief Create a savepoint
+     *
+     * @param segregated The arena to create a savepoint for
+     * @return SegregatedSavepoint A savepoint that rolls back when it ends
+     */
+    static SegregatedSavepoint begin(SegregatedArena& segregated) {
+        return SegregatedSavepoint{&segregated, TempArenaMemory::begin(*segregated.parent),
+                                   segregated.buckets};
+    }
+
+    /**
+     * @brief Roll the parent and every bucket back to the savepoint
+     */
+    void end();
+
+    /**
+     * @brief Destructor that automatically ends the savepoint if not already ended
+     */
+    ~SegregatedSavepoint() {
+        if (arena) {
+            end();
+        }
+    }
+};
+
+} // namespace alloc
+
+// Include template implementation
+#include "SegregatedArena.tpp"
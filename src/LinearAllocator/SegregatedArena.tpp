@@ -0,0 +1,110 @@
+// src/LinearAllocator/SegregatedArena.tpp
+#pragma once
+
+#include <algorithm>
+#include <bit>
+
+namespace alloc {
+
+inline SegregatedArena::SegregatedArena(LinearAllocator& parent_arena, size_t chunk_bytes,
+                                        size_t large_bytes)
+    : parent(&parent_arena), chunk_size(chunk_bytes),
+      large_threshold(std::min(large_bytes, chunk_bytes / 2)),
+      base_used(parent_arena.used), base_prev_used(parent_arena.prev_used),
+      base_destructors(parent_arena.destructors),
+      buckets{LinearAllocator(nullptr, 0, parent_arena.zero_on_alloc),
+              LinearAllocator(nullptr, 0, parent_arena.zero_on_alloc),
+              LinearAllocator(nullptr, 0, parent_arena.zero_on_alloc),
+              LinearAllocator(nullptr, 0, parent_arena.zero_on_alloc),
+              LinearAllocator(nullptr, 0, parent_arena.zero_on_alloc),
+              LinearAllocator(nullptr, 0, parent_arena.zero_on_alloc),
+              LinearAllocator(nullptr, 0, parent_arena.zero_on_alloc)} {}
+
+inline std::expected<void*, AllocError> SegregatedArena::allocate_bytes(size_t size_in_bytes,
+                                                                       size_t alignment
+                                                                       LINEAR_ALLOCATOR_CALLSITE_PARAM) {
+    // Ensure alignment is a power of 2
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+        return std::unexpected(AllocError::InvalidAlignment);
+    }
+
+    if (alignment > kMaxBucketAlignment || size_in_bytes >= large_threshold) {
+        return parent->allocate_bytes(size_in_bytes, alignment LINEAR_ALLOCATOR_CALLSITE_ARG);
+    }
+
+    LinearAllocator& bucket = buckets[std::countr_zero(alignment)];
+    auto result = bucket.allocate_bytes(size_in_bytes, alignment LINEAR_ALLOCATOR_CALLSITE_ARG);
+    if (result) {
+        return result;
+    }
+
+    // The rest of the old chunk is left unused, large_threshold keeps that small
+    auto chunk = parent->allocate_bytes(chunk_size, alignment LINEAR_ALLOCATOR_CALLSITE_ARG);
+    if (!chunk) {
+        // No room for a whole chunk, the request itself may still fit in the parent
+        return parent->allocate_bytes(size_in_bytes, alignment LINEAR_ALLOCATOR_CALLSITE_ARG);
+    }
+    bucket = LinearAllocator(static_cast<uint8_t*>(chunk.value()), chunk_size, parent->zero_on_alloc);
+    if (parent->zero_on_alloc) {
+        bucket.known_zero_offset = 0; // The parent zeroed the chunk
+    }
+    return bucket.allocate_bytes(size_in_bytes, alignment LINEAR_ALLOCATOR_CALLSITE_ARG);
+}
+
+template <typename T>
+std::expected<T*, AllocError> SegregatedArena::allocate(size_t count,
+                                                        size_t alignment LINEAR_ALLOCATOR_CALLSITE_PARAM) {
+    static_assert(std::is_trivially_destructible_v<T>,
+                  "SegregatedArena does not run destructors, use the parent's make()");
+    if (count > SIZE_MAX / sizeof(T)) {
+        return std::unexpected(AllocError::OutOfMemory);
+    }
+    auto result = allocate_bytes(sizeof(T) * count, alignment LINEAR_ALLOCATOR_CALLSITE_ARG);
+    if (!result) {
+        return std::unexpected(result.error());
+    }
+    return static_cast<T*>(result.value());
+}
+
+inline void SegregatedArena::reset() {
+    TempArenaMemory{parent, base_used, base_prev_used, base_destructors}.end();
+    for (LinearAllocator& bucket : buckets) {
+        bucket = LinearAllocator(nullptr, 0, parent->zero_on_alloc);
+    }
+}
+
+inline void SegregatedSavepoint::end() {
+    if (!arena) {
+        return;
+    }
+
+    // Chunks carved since the savepoint go back to the parent in one step
+    parent_savepoint.end();
+
+    for (size_t i = 0; i < SegregatedArena::kBucketCount; i++) {
+        LinearAllocator& bucket = arena->buckets[i];
+        const LinearAllocator& saved = saved_buckets[i];
+
+        if (bucket.buffer == saved.buffer) {
+            // Still on the same chunk: roll it back like any arena
+            TempArenaMemory{&bucket, saved.used, saved.prev_used, saved.destructors}.end();
+            continue;
+        }
+
+        // The bucket moved on to a newer chunk, go back to the saved one. Its
+        // allocations after the savepoint are gone from the copy, and its memory
+        // past the savepoint is no longer known to be zero.
+        bucket = saved;
+        if (bucket.buffer) {
+#ifdef LINEAR_ALLOCATOR_DEBUG
+            bucket.used = bucket.capacity;
+            bucket.debug_release(saved.used);
+            bucket.used = saved.used;
+#endif
+            bucket.known_zero_offset = bucket.capacity;
+        }
+    }
+    arena = nullptr; // Mark as ended
+}
+
+} // namespace alloc
@@ -0,0 +1,185 @@
+// src/LinearAllocator/SharedArena.hpp
+#pragma once
+
+#include <atomic>
+#include "ConcurrentLinearAllocator.hpp"
+
+namespace alloc {
+
+/**
+ * @brief Maximum number of reader slots in a shared arena
+ */
+inline constexpr size_t kSharedArenaReaders = 16;
+
+inline constexpr uint64_t kSharedArenaMagic = 0x414E4552414D4853ull; ///< "SHMARENA" in little-endian byte order
+inline constexpr uint64_t kSharedReaderFree = ~uint64_t(0);     ///< Slot not registered
+inline constexpr uint64_t kSharedReaderIdle = ~uint64_t(0) - 1; ///< Slot registered, nothing pinned
+
+/**
+ * @brief Location of a message in a shared arena, the only thing sent to readers
+ */
+struct SharedRef {
+    uint64_t epoch;  ///< Generation the message was allocated in
+    uint64_t offset; ///< Offset of the message from the start of the data area
+    uint64_t size;   ///< Size of the message in bytes
+};
+
+/**
+ * @brief Reader slot, one cache line each so readers do not share lines
+ */
+struct SharedReaderSlot {
+    alignas(kCacheLineSize) std::atomic<uint64_t> pinned; ///< Pinned epoch, or kSharedReaderFree / kSharedReaderIdle
+};
+
+/**
+ * @brief Control block at the start of the shared mapping
+ */
+struct SharedArenaHeader {
+    uint64_t magic;    ///< kSharedArenaMagic, identifies an initialized arena
+    uint64_t capacity; ///< Size of one generation in bytes
+    alignas(kCacheLineSize) std::atomic<uint64_t> used;  ///< Bytes used in the current generation
+    alignas(kCacheLineSize) std::atomic<uint64_t> epoch; ///< Current generation, counting from 0
+    SharedReaderSlot readers[kSharedArenaReaders];       ///< Epoch pinned by each reader
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+              "Shared arena counters must be lock-free to work across processes");
+
+/**
+ * @brief A linear allocator in POSIX shared memory for zero-copy message passing (Linux only)
+ *
+ * Producers build messages in the arena and send readers a SharedRef, three
+ * integers, instead of the message itself. Space is claimed with a
+ * compare-and-swap on the shared `used` offset, so several producer threads or
+ * processes can allocate at once.
+ *
+ * The data area holds two generations. Epoch e allocates in generation e % 2, so
+ * reset() moves on to the other generation and leaves the messages of the
+ * previous epoch readable. Memory of epoch e is only reused when epoch e + 2
+ * starts, and reset() waits for that until no reader has a message of epoch e
+ * or older pinned. A reader that pins a message whose generation was already
+ * reused gets Expired instead of overwritten data.
+ *
+ * reset() must only be called by one process while nobody allocates. A reader
+ * that dies while pinning blocks reset() until its slot is released.
+ */
+struct SharedArena {
+    SharedArenaHeader* header; ///< Control block at the start of the mapping
+    uint8_t* data;             ///< Start of the two generations
+    size_t mapped_size;        ///< Length of the mapping in bytes
+    int fd;                    ///< Descriptor of the shared memory object
+    bool zero_on_alloc;        ///< Whether to zero memory on allocation
+
+    /**
+     * @brief Create a new shared arena
+     *
+     * Without a name the memory comes from `memfd_create`; it is shared with
+     * children through fork() or with other processes by passing `fd` over a Unix
+     * socket. With a name it comes from `shm_open`, and other processes call open().
+     *
+     * @param capacity_in_bytes Size of one generation in bytes
+     * @param zero_memory Whether to zero memory on allocation
+     * @param shm_name Name for shm_open, e.g. "/my_arena", or nullptr for an anonymous memfd
+     * @return std::expected<SharedArena, AllocError> A new arena or an error
+     */
+    static std::expected<SharedArena, AllocError> create(size_t capacity_in_bytes,
+                                                         bool zero_memory = true,
+                                                         const char* shm_name = nullptr);
+
+    /**
+     * @brief Map an arena created by another process under a shm_open name
+     */
+    static std::expected<SharedArena, AllocError> open(const char* shm_name, bool zero_memory = true);
+
+    /**
+     * @brief Map an arena from a descriptor received from another process
+     */
+    static std::expected<SharedArena, AllocError> open_fd(int shared_fd, bool zero_memory = true);
+
+    /**
+     * @brief Remove a shm_open name; mappings that exist stay valid
+     */
+    static void unlink(const char* shm_name);
+
+    /**
+     * @brief Allocate memory with a specified alignment
+     *
+     * @tparam T The type to allocate for
+     * @param count The number of elements to allocate
+     * @param alignment The alignment required (must be a power of 2)
+     * @return std::expected<T*, AllocError> Pointer to the allocated memory or an error
+     */
+    template <typename T>
+    std::expected<T*, AllocError> allocate(size_t count = 1, size_t alignment = alignof(T));
+
+    /**
+     * @brief Allocate memory in the current generation, safe from any thread or process
+     *
+     * @param size_in_bytes The size to allocate in bytes
+     * @param alignment The alignment required (must be a power of 2)
+     * @return std::expected<void*, AllocError> Pointer to the allocated memory or an error
+     */
+    std::expected<void*, AllocError> allocate_bytes(size_t size_in_bytes,
+                                                   size_t alignment = alignof(std::max_align_t));
+
+    /**
+     * @brief Describe a message allocated in the current epoch so it can be sent to readers
+     */
+    SharedRef ref(const void* message, size_t size_in_bytes) const {
+        return SharedRef{header->epoch.load(std::memory_order_relaxed),
+                         static_cast<uint64_t>(static_cast<const uint8_t*>(message) - data),
+                         size_in_bytes};
+    }
+
+    /**
+     * @brief Start a new epoch in the other generation
+     *
+     * Messages of the epoch that just ended stay readable. Waits until no reader
+     * pins a message of the generation that is about to be reused.
+     */
+    void reset();
+
+    /**
+     * @brief Reader: claim a reader slot
+     *
+     * @return std::expected<size_t, AllocError> The slot index, or WouldBlock if every slot is taken
+     */
+    std::expected<size_t, AllocError> register_reader();
+
+    /**
+     * @brief Reader: give a slot back, unpinning anything it holds
+     */
+    void unregister_reader(size_t slot) {
+        header->readers[slot].pinned.store(kSharedReaderFree, std::memory_order_release);
+    }
+
+    /**
+     * @brief Reader: protect a message from reuse and get a pointer to it
+     *
+     * A slot pins one message at a time; pinning another replaces it.
+     *
+     * @param slot Slot returned by register_reader()
+     * @param message Reference received from the producer
+     * @return std::expected<const uint8_t*, AllocError> The message, Expired if its
+     *         generation has already been reused, or InvalidFree if the reference does not
+     *         lie inside this arena
+     */
+    std::expected<const uint8_t*, AllocError> pin(size_t slot, const SharedRef& message);
+
+    /**
+     * @brief Reader: release the pinned message, it must not be read afterwards
+     */
+    void unpin(size_t slot) {
+        header->readers[slot].pinned.store(kSharedReaderIdle, std::memory_order_release);
+    }
+
+    /**
+     * @brief Unmap the arena and close the descriptor, the memory lives on in other processes
+     */
+    void destroy();
+};
+
+} // namespace alloc
+
+// Include template implementation
+#include "SharedArena.tpp"
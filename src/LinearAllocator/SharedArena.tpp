@@ -0,0 +1,214 @@
+// src/LinearAllocator/SharedArena.tpp
+#pragma once
+
+#include <fcntl.h>
+#include <new>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace alloc {
+
+inline std::expected<SharedArena, AllocError> SharedArena::create(
+    size_t capacity_in_bytes, bool zero_memory, const char* shm_name) {
+
+    if (capacity_in_bytes == 0) {
+        return std::unexpected(AllocError::OutOfMemory);
+    }
+
+    int shared_fd = shm_name ? shm_open(shm_name, O_CREAT | O_EXCL | O_RDWR, 0600)
+                             : memfd_create("linear_allocator_shared", MFD_CLOEXEC);
+    if (shared_fd < 0) {
+        return std::unexpected(AllocError::FileError);
+    }
+
+    // Fresh shared memory reads as zero, so only the header needs initializing
+    capacity_in_bytes = (capacity_in_bytes + kCacheLineSize - 1) & ~(kCacheLineSize - 1);
+    size_t mapped_size = sizeof(SharedArenaHeader) + 2 * capacity_in_bytes;
+    if (ftruncate(shared_fd, static_cast<off_t>(mapped_size)) != 0) {
+        close(shared_fd);
+        if (shm_name) {
+            shm_unlink(shm_name);
+        }
+        return std::unexpected(AllocError::OutOfMemory);
+    }
+
+    void* mem = mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_SHARED, shared_fd, 0);
+    if (mem == MAP_FAILED) {
+        close(shared_fd);
+        if (shm_name) {
+            shm_unlink(shm_name);
+        }
+        return std::unexpected(AllocError::FileError);
+    }
+
+    auto* header = new (mem) SharedArenaHeader{};
+    header->capacity = capacity_in_bytes;
+    for (SharedReaderSlot& slot : header->readers) {
+        slot.pinned.store(kSharedReaderFree, std::memory_order_relaxed);
+    }
+    // Openers check the magic last, after the rest of the header is in place
+    std::atomic_thread_fence(std::memory_order_release);
+    header->magic = kSharedArenaMagic;
+
+    return SharedArena{header, static_cast<uint8_t*>(mem) + sizeof(SharedArenaHeader),
+                       mapped_size, shared_fd, zero_memory};
+}
+
+inline std::expected<SharedArena, AllocError> SharedArena::open(const char* shm_name, bool zero_memory) {
+    int shared_fd = shm_open(shm_name, O_RDWR, 0600);
+    if (shared_fd < 0) {
+        return std::unexpected(AllocError::FileError);
+    }
+
+    auto result = open_fd(shared_fd, zero_memory);
+    if (!result) {
+        close(shared_fd);
+    }
+    return result;
+}
+
+inline std::expected<SharedArena, AllocError> SharedArena::open_fd(int shared_fd, bool zero_memory) {
+    struct stat info;
+    if (fstat(shared_fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(SharedArenaHeader)) {
+        return std::unexpected(AllocError::FileError);
+    }
+
+    size_t mapped_size = static_cast<size_t>(info.st_size);
+    void* mem = mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_SHARED, shared_fd, 0);
+    if (mem == MAP_FAILED) {
+        return std::unexpected(AllocError::FileError);
+    }
+
+    auto* header = static_cast<SharedArenaHeader*>(mem);
+    bool valid = header->magic == kSharedArenaMagic &&
+                 sizeof(SharedArenaHeader) + 2 * header->capacity <= mapped_size;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (!valid) {
+        munmap(mem, mapped_size);
+        return std::unexpected(AllocError::FileError);
+    }
+
+    return SharedArena{header, static_cast<uint8_t*>(mem) + sizeof(SharedArenaHeader),
+                       mapped_size, shared_fd, zero_memory};
+}
+
+inline void SharedArena::unlink(const char* shm_name) {
+    shm_unlink(shm_name);
+}
+
+inline std::expected<void*, AllocError> SharedArena::allocate_bytes(
+    size_t size_in_bytes, size_t alignment) {
+
+    // Ensure alignment is a power of 2
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+        return std::unexpected(AllocError::InvalidAlignment);
+    }
+
+    // Offsets are aligned relative to the generation, which starts on a cache line
+    // in every process; larger alignments depend on where the mapping lands
+    size_t capacity = static_cast<size_t>(header->capacity);
+    uint8_t* generation = data + (header->epoch.load(std::memory_order_relaxed) % 2) * capacity;
+    uintptr_t base = reinterpret_cast<uintptr_t>(generation);
+    uint64_t current = header->used.load(std::memory_order_relaxed);
+    size_t offset;
+
+    // Claim [offset, offset + size) exactly like ConcurrentLinearAllocator
+    do {
+        uintptr_t aligned = (base + current + alignment - 1) & ~(alignment - 1);
+        offset = aligned - base;
+
+        if (offset > capacity || size_in_bytes > capacity - offset) {
+            return std::unexpected(AllocError::OutOfMemory);
+        }
+    } while (!header->used.compare_exchange_weak(current, offset + size_in_bytes,
+                                                 std::memory_order_relaxed,
+                                                 std::memory_order_relaxed));
+
+    // The generation was used two epochs ago, so its memory is not known to be zero
+    if (zero_on_alloc) {
+        zero_bytes(generation + offset, size_in_bytes);
+    }
+    return generation + offset;
+}
+
+template <typename T>
+inline std::expected<T*, AllocError> SharedArena::allocate(size_t count, size_t alignment) {
+    if (count == 0) {
+        return static_cast<T*>(nullptr);
+    }
+
+    auto result = allocate_bytes(count * sizeof(T), alignment);
+    if (!result) {
+        return std::unexpected(result.error());
+    }
+
+    return static_cast<T*>(result.value());
+}
+
+inline void SharedArena::reset() {
+    // Publish the new epoch before looking at the readers. A reader pins first and
+    // checks the epoch second, so with both sides sequentially consistent either
+    // the reader sees the new epoch and gives up, or we see its pin and wait.
+    uint64_t next = header->epoch.load(std::memory_order_relaxed) + 1;
+    header->epoch.store(next, std::memory_order_seq_cst);
+
+    if (next >= 2) {
+        uint64_t reused = next - 2;
+        for (SharedReaderSlot& slot : header->readers) {
+            uint64_t pinned = slot.pinned.load(std::memory_order_seq_cst);
+            while (pinned < kSharedReaderIdle && pinned <= reused) {
+                sched_yield();
+                pinned = slot.pinned.load(std::memory_order_seq_cst);
+            }
+        }
+    }
+
+    header->used.store(0, std::memory_order_relaxed);
+}
+
+inline std::expected<size_t, AllocError> SharedArena::register_reader() {
+    for (size_t i = 0; i < kSharedArenaReaders; i++) {
+        uint64_t expected = kSharedReaderFree;
+        if (header->readers[i].pinned.compare_exchange_strong(expected, kSharedReaderIdle,
+                                                              std::memory_order_acq_rel)) {
+            return i;
+        }
+    }
+    return std::unexpected(AllocError::WouldBlock);
+}
+
+inline std::expected<const uint8_t*, AllocError> SharedArena::pin(size_t slot, const SharedRef& message) {
+    // A reference comes from another process, so it must lie inside the generation of its
+    // epoch, and that epoch must have started, before anything is pinned or read
+    uint64_t capacity = header->capacity;
+    uint64_t generation = (message.epoch % 2) * capacity;
+    if (message.epoch > header->epoch.load(std::memory_order_acquire) ||
+        message.offset < generation || message.offset - generation > capacity ||
+        message.size > capacity - (message.offset - generation)) {
+        return std::unexpected(AllocError::InvalidFree);
+    }
+
+    header->readers[slot].pinned.store(message.epoch, std::memory_order_seq_cst);
+    if (header->epoch.load(std::memory_order_seq_cst) >= message.epoch + 2) {
+        header->readers[slot].pinned.store(kSharedReaderIdle, std::memory_order_release);
+        return std::unexpected(AllocError::Expired);
+    }
+    return data + message.offset;
+}
+
+inline void SharedArena::destroy() {
+    if (header) {
+        munmap(header, mapped_size);
+    }
+    if (fd >= 0) {
+        close(fd);
+    }
+    header = nullptr;
+    data = nullptr;
+    mapped_size = 0;
+    fd = -1;
+}
+
+} // namespace alloc
@@ -0,0 +1,142 @@
+// src/LinearAllocator/StackAllocator.hpp
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <expected>
+#include "LinearAllocator.hpp"
+
+namespace alloc {
+
+/**
+ * @brief Header stored directly in front of every stack allocation
+ *
+ * Written and read with memcpy, so allocations with a small alignment do not
+ * need extra padding to align the header.
+ */
+struct StackAllocationHeader {
+    size_t prev_offset; ///< `used` before this allocation, restored by free()
+    size_t prev_top;    ///< Offset of the allocation below this one, for order checks
+};
+
+/**
+ * @brief A stack (LIFO) allocator: a linear allocator whose allocations can be freed in reverse order
+ *
+ * Uses the same buffer model as LinearAllocator, but stores a StackAllocationHeader
+ * in front of every allocation. free() pops the top allocation in O(1) by restoring
+ * the offset saved in its header. Builds without NDEBUG report out-of-order frees as
+ * InvalidFree; release builds trust the caller.
+ *
+ * Based on "Memory Allocation Strategies - Part 3" by Ginger Bill.
+ */
+struct StackAllocator {
+    static constexpr size_t kNoAllocation = SIZE_MAX; ///< `top` of an empty stack
+
+    uint8_t* buffer;    ///< Pointer to the memory buffer
+    size_t capacity;    ///< Total capacity of the allocator in bytes
+    size_t used;        ///< Current number of bytes used
+    size_t top;         ///< Offset of the most recent live allocation, or kNoAllocation
+    size_t known_zero_offset; ///< Memory at or past this offset has never been handed out and is zero
+    bool zero_on_alloc; ///< Whether to zero memory on allocation
+
+    /**
+     * @brief Construct a new Stack Allocator
+     *
+     * @param buffer_ptr Pointer to the memory buffer
+     * @param capacity_in_bytes Capacity of the allocator in bytes
+     * @param zero_memory Whether to zero memory on allocation
+     */
+    StackAllocator(uint8_t* buffer_ptr, size_t capacity_in_bytes, bool zero_memory = true)
+        : buffer(buffer_ptr), capacity(capacity_in_bytes), used(0), top(kNoAllocation),
+          known_zero_offset(capacity_in_bytes), zero_on_alloc(zero_memory) {}
+
+    /**
+     * @brief Create a new Stack Allocator with a given capacity
+     *
+     * @param size_in_bytes The total size of the allocator in bytes
+     * @param zero_memory Whether to zero memory on allocation
+     * @return std::expected<StackAllocator, AllocError> A new allocator or an error
+     */
+    static std::expected<StackAllocator, AllocError> create(
+        size_t size_in_bytes, bool zero_memory = true);
+
+    /**
+     * @brief Create a new Stack Allocator from an existing buffer
+     *
+     * @param buffer_ptr Pointer to the memory buffer
+     * @param size_in_bytes The total size of the buffer in bytes
+     * @param zero_memory Whether to zero memory on allocation
+     * @return std::expected<StackAllocator, AllocError> A new allocator or an error
+     */
+    static std::expected<StackAllocator, AllocError> create_from_buffer(
+        uint8_t* buffer_ptr, size_t size_in_bytes, bool zero_memory = true);
+
+    /**
+     * @brief Allocate memory with a specified alignment
+     *
+     * @tparam T The type to allocate for
+     * @param count The number of elements to allocate
+     * @param alignment The alignment required (must be a power of 2)
+     * @return std::expected<T*, AllocError> Pointer to the allocated memory or an error
+     */
+    template <typename T>
+    std::expected<T*, AllocError> allocate(size_t count = 1, size_t alignment = alignof(T));
+
+    /**
+     * @brief Allocate uninitialized memory with a specified alignment
+     *
+     * @param size_in_bytes The size to allocate in bytes
+     * @param alignment The alignment required (must be a power of 2)
+     * @return std::expected<void*, AllocError> Pointer to the allocated memory or an error
+     */
+    std::expected<void*, AllocError> allocate_bytes(size_t size_in_bytes,
+                                                   size_t alignment = alignof(std::max_align_t));
+
+    /**
+     * @brief Free the most recent allocation
+     *
+     * Freeing nullptr does nothing. In NDEBUG builds the order is not checked, and
+     * freeing a lower allocation also frees everything above it.
+     *
+     * @param ptr Pointer returned by the latest live allocation
+     * @return std::expected<void, AllocError> Nothing, or InvalidFree for a pointer
+     *         outside the buffer or (without NDEBUG) not at the top of the stack
+     */
+    std::expected<void, AllocError> free(void* ptr);
+
+    /**
+     * @brief Resize an allocation, in place if it is at the top of the stack
+     *
+     * Other allocations are copied into a new allocation on top; the old one stays
+     * allocated until everything above it is freed.
+     *
+     * @tparam T The type of the allocation
+     * @param old_ptr Pointer to the old memory
+     * @param old_count Old element count
+     * @param new_count New element count
+     * @param alignment Alignment requirements
+     * @return std::expected<T*, AllocError> Pointer to resized memory or an error
+     */
+    template <typename T>
+    std::expected<T*, AllocError> resize(T* old_ptr, size_t old_count,
+                                         size_t new_count,
+                                         size_t alignment = alignof(T));
+
+    /**
+     * @brief Free every allocation at once
+     */
+    void reset() {
+        used = 0;
+        top = kNoAllocation;
+    }
+
+    /**
+     * @brief Read the header stored in front of an allocation
+     */
+    StackAllocationHeader header_of(size_t offset) const;
+};
+
+} // namespace alloc
+
+// Include template implementation
+#include "StackAllocator.tpp"
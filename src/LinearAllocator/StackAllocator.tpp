@@ -0,0 +1,164 @@
+// src/LinearAllocator/StackAllocator.tpp
+#pragma once
+
+#include <cstdlib>
+#include <cstring>
+
+namespace alloc {
+
+inline std::expected<StackAllocator, AllocError> StackAllocator::create(
+    size_t size_in_bytes, bool zero_memory) {
+
+    if (size_in_bytes == 0) {
+        return std::unexpected(AllocError::OutOfMemory);
+    }
+
+    // calloc can hand out fresh zero pages without touching them
+    uint8_t* mem = static_cast<uint8_t*>(zero_memory ? std::calloc(size_in_bytes, 1)
+                                                     : std::malloc(size_in_bytes));
+    if (!mem) {
+        return std::unexpected(AllocError::OutOfMemory);
+    }
+
+    StackAllocator result(mem, size_in_bytes, zero_memory);
+    if (zero_memory) {
+        result.known_zero_offset = 0;
+    }
+    return result;
+}
+
+inline std::expected<StackAllocator, AllocError> StackAllocator::create_from_buffer(
+    uint8_t* buffer_ptr, size_t size_in_bytes, bool zero_memory) {
+
+    if (!buffer_ptr || size_in_bytes == 0) {
+        return std::unexpected(AllocError::OutOfMemory);
+    }
+
+    return StackAllocator(buffer_ptr, size_in_bytes, zero_memory);
+}
+
+inline std::expected<void*, AllocError> StackAllocator::allocate_bytes(
+    size_t size_in_bytes, size_t alignment) {
+
+    // Ensure alignment is a power of 2
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+        return std::unexpected(AllocError::InvalidAlignment);
+    }
+
+    // Leave room for the header, then align the address that follows it
+    uintptr_t current = reinterpret_cast<uintptr_t>(buffer + used) + sizeof(StackAllocationHeader);
+    uintptr_t aligned = (current + alignment - 1) & ~(alignment - 1);
+    size_t offset = static_cast<size_t>(aligned - reinterpret_cast<uintptr_t>(buffer));
+
+    if (offset + size_in_bytes > capacity) {
+        return std::unexpected(AllocError::OutOfMemory);
+    }
+
+    StackAllocationHeader header{used, top};
+    std::memcpy(buffer + offset - sizeof(StackAllocationHeader), &header, sizeof(header));
+
+    top = offset;
+    used = offset + size_in_bytes;
+
+    // Zero the memory if requested, skipping memory that was never handed out
+    if (zero_on_alloc) {
+        size_t end = used < known_zero_offset ? used : known_zero_offset;
+        if (offset < end) {
+            zero_bytes(buffer + offset, end - offset);
+        }
+    }
+    if (used > known_zero_offset) {
+        known_zero_offset = used;
+    }
+
+    return buffer + offset;
+}
+
+inline StackAllocationHeader StackAllocator::header_of(size_t offset) const {
+    StackAllocationHeader header;
+    std::memcpy(&header, buffer + offset - sizeof(StackAllocationHeader), sizeof(header));
+    return header;
+}
+
+inline std::expected<void, AllocError> StackAllocator::free(void* ptr) {
+    if (!ptr) {
+        return {};
+    }
+
+    uint8_t* bytes = static_cast<uint8_t*>(ptr);
+    if (bytes < buffer + sizeof(StackAllocationHeader) || bytes > buffer + used) {
+        return std::unexpected(AllocError::InvalidFree);
+    }
+
+    size_t offset = static_cast<size_t>(bytes - buffer);
+#ifndef NDEBUG
+    // Only the top of the stack may be freed
+    if (offset != top) {
+        return std::unexpected(AllocError::InvalidFree);
+    }
+#endif
+
+    StackAllocationHeader header = header_of(offset);
+    used = header.prev_offset;
+    top = header.prev_top;
+    return {};
+}
+
+template <typename T>
+inline std::expected<T*, AllocError> StackAllocator::allocate(size_t count, size_t alignment) {
+    if (count == 0) {
+        return static_cast<T*>(nullptr);
+    }
+
+    auto result = allocate_bytes(count * sizeof(T), alignment);
+    if (!result) {
+        return std::unexpected(result.error());
+    }
+
+    return static_cast<T*>(result.value());
+}
+
+template <typename T>
+inline std::expected<T*, AllocError> StackAllocator::resize(
+    T* old_ptr, size_t old_count, size_t new_count, size_t alignment) {
+
+    if (!old_ptr || old_count == 0) {
+        return allocate<T>(new_count, alignment);
+    }
+
+    size_t old_size = old_count * sizeof(T);
+    size_t new_size = new_count * sizeof(T);
+    size_t offset = static_cast<size_t>(reinterpret_cast<uint8_t*>(old_ptr) - buffer);
+
+    // The top of the stack grows or shrinks in place
+    if (offset == top) {
+        if (offset + new_size > capacity) {
+            return std::unexpected(AllocError::OutOfMemory);
+        }
+        used = offset + new_size;
+
+        if (zero_on_alloc && new_size > old_size) {
+            size_t end = used < known_zero_offset ? used : known_zero_offset;
+            if (offset + old_size < end) {
+                zero_bytes(buffer + offset + old_size, end - offset - old_size);
+            }
+        }
+        if (used > known_zero_offset) {
+            known_zero_offset = used;
+        }
+        return old_ptr;
+    }
+
+    auto new_mem = allocate<T>(new_count, alignment);
+    if (!new_mem) {
+        return std::unexpected(new_mem.error());
+    }
+
+    // Copy old data to new memory, limited by the smaller of the two sizes
+    size_t copy_size = old_size < new_size ? old_size : new_size;
+    copy_bytes(new_mem.value(), old_ptr, copy_size);
+
+    return new_mem;
+}
+
+} // namespace alloc
@@ -0,0 +1,150 @@
+// src/LinearAllocator/StaticLinearAllocator.hpp
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+#include <expected>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "LinearAllocator.hpp"
+
+namespace alloc {
+
+/**
+ * @brief When a StaticLinearAllocator zeroes the memory it hands out
+ */
+enum class ZeroPolicy {
+    None,      ///< Memory is handed out as is
+    OnAllocate ///< Every allocation is zeroed
+};
+
+/**
+ * @brief A linear allocator with inline storage and compile-time parameters
+ *
+ * Capacity, alignment and zeroing are template parameters, so alignment checks
+ * become static_asserts and the zeroing branch disappears: the fast path of
+ * allocate_bytes is an add, a mask and a compare. The storage is a member array,
+ * so the allocator can live on the stack, in a global or inside another object.
+ *
+ * The byte-level API works on offsets into the storage and is constexpr, so the
+ * allocator can build tables at compile time. Typed allocation needs a cast from
+ * bytes and is only available at run time.
+ *
+ * @tparam Capacity Size of the inline storage in bytes
+ * @tparam DefaultAlign Alignment of the storage and of allocate_bytes() by default
+ * @tparam Zero Whether allocations are zeroed
+ */
+template <size_t Capacity, size_t DefaultAlign = alignof(std::max_align_t),
+          ZeroPolicy Zero = ZeroPolicy::None>
+struct StaticLinearAllocator {
+    static_assert(Capacity > 0, "Capacity must not be 0");
+    static_assert(DefaultAlign != 0 && (DefaultAlign & (DefaultAlign - 1)) == 0,
+                  "DefaultAlign must be a power of 2");
+
+    static constexpr size_t kCapacity = Capacity;         ///< Size of the storage in bytes
+    static constexpr size_t kStorageAlign = DefaultAlign; ///< Largest alignment an allocation can ask for
+
+    alignas(DefaultAlign) uint8_t storage[Capacity]; ///< Inline memory, uninitialized at run time
+    size_t used;      ///< Current number of bytes used
+    size_t prev_used; ///< Offset of the previous allocation (for resize operations)
+
+    /**
+     * @brief Construct an empty allocator
+     *
+     * At run time the storage is left uninitialized. During constant evaluation it
+     * is zeroed, since every byte of a constexpr object must be initialized.
+     */
+    constexpr StaticLinearAllocator() : used(0), prev_used(0) {
+        if consteval {
+            std::fill_n(storage, Capacity, uint8_t(0));
+        }
+    }
+
+    /**
+     * @brief Allocate bytes with a compile-time alignment
+     *
+     * @tparam Align The alignment required, at most DefaultAlign
+     * @param size_in_bytes The size to allocate in bytes
+     * @return std::expected<uint8_t*, AllocError> Pointer to the allocated memory or an error
+     */
+    template <size_t Align = DefaultAlign>
+    constexpr std::expected<uint8_t*, AllocError> allocate_bytes(size_t size_in_bytes) {
+        static_assert(Align != 0 && (Align & (Align - 1)) == 0, "Align must be a power of 2");
+        static_assert(Align <= DefaultAlign, "Align must not exceed the storage alignment");
+
+        // The storage is DefaultAlign aligned, so aligning the offset aligns the pointer
+        size_t aligned = (used + Align - 1) & ~(Align - 1);
+        if (aligned + size_in_bytes > Capacity) {
+            return std::unexpected(AllocError::OutOfMemory);
+        }
+
+        prev_used = aligned;
+        used = aligned + size_in_bytes;
+        if constexpr (Zero == ZeroPolicy::OnAllocate) {
+            std::fill_n(storage + aligned, size_in_bytes, uint8_t(0));
+        }
+        return storage + aligned;
+    }
+
+    /**
+     * @brief Allocate memory for `count` objects of type T
+     *
+     * @tparam T The type to allocate for, alignof(T) must not exceed DefaultAlign
+     * @param count The number of elements to allocate
+     * @return std::expected<T*, AllocError> Pointer to the allocated memory or an error
+     */
+    template <typename T>
+    std::expected<T*, AllocError> allocate(size_t count = 1);
+
+    /**
+     * @brief Allocate and construct an object of a trivially destructible type
+     *
+     * @tparam T The type to construct
+     * @param args Arguments forwarded to the constructor
+     * @return std::expected<T*, AllocError> Pointer to the new object or an error
+     */
+    template <typename T, typename... Args>
+    std::expected<T*, AllocError> make(Args&&... args);
+
+    /**
+     * @brief Resize an allocation, in place if it is the last one
+     *
+     * @tparam Align The alignment of the allocation
+     * @param old_ptr Pointer to the old memory
+     * @param old_size Old size in bytes
+     * @param new_size New size in bytes
+     * @return std::expected<uint8_t*, AllocError> Pointer to resized memory or an error
+     */
+    template <size_t Align = DefaultAlign>
+    constexpr std::expected<uint8_t*, AllocError> resize_bytes(uint8_t* old_ptr, size_t old_size,
+                                                               size_t new_size);
+
+    /**
+     * @brief Offset of a pointer into the storage
+     */
+    constexpr size_t offset_of(const uint8_t* ptr) const {
+        return static_cast<size_t>(ptr - storage);
+    }
+
+    /**
+     * @brief Reset the allocator, effectively freeing all allocations
+     */
+    constexpr void reset() {
+        used = 0;
+        prev_used = 0;
+    }
+
+    /**
+     * @brief Number of bytes still available (before alignment)
+     */
+    constexpr size_t remaining() const {
+        return Capacity - used;
+    }
+};
+
+} // namespace alloc
+
+// Include template implementation
+#include "StaticLinearAllocator.tpp"
@@ -0,0 +1,79 @@
+// src/LinearAllocator/StaticLinearAllocator.tpp
+#pragma once
+
+namespace alloc {
+
+template <size_t Capacity, size_t DefaultAlign, ZeroPolicy Zero>
+template <typename T>
+inline std::expected<T*, AllocError> StaticLinearAllocator<Capacity, DefaultAlign, Zero>::allocate(
+    size_t count) {
+
+    static_assert(alignof(T) <= DefaultAlign, "alignof(T) must not exceed the storage alignment");
+
+    if (count == 0) {
+        return static_cast<T*>(nullptr);
+    }
+    if (count > Capacity / sizeof(T)) {
+        return std::unexpected(AllocError::OutOfMemory);
+    }
+
+    auto result = allocate_bytes<alignof(T)>(count * sizeof(T));
+    if (!result) {
+        return std::unexpected(result.error());
+    }
+
+    return reinterpret_cast<T*>(result.value());
+}
+
+template <size_t Capacity, size_t DefaultAlign, ZeroPolicy Zero>
+template <typename T, typename... Args>
+inline std::expected<T*, AllocError> StaticLinearAllocator<Capacity, DefaultAlign, Zero>::make(
+    Args&&... args) {
+
+    // There is no destructor list, the storage may go away without a reset
+    static_assert(std::is_trivially_destructible_v<T>,
+                  "StaticLinearAllocator::make only supports trivially destructible types");
+
+    auto storage_result = allocate<T>(1);
+    if (!storage_result) {
+        return storage_result;
+    }
+    return new (storage_result.value()) T(std::forward<Args>(args)...);
+}
+
+template <size_t Capacity, size_t DefaultAlign, ZeroPolicy Zero>
+template <size_t Align>
+constexpr std::expected<uint8_t*, AllocError>
+StaticLinearAllocator<Capacity, DefaultAlign, Zero>::resize_bytes(
+    uint8_t* old_ptr, size_t old_size, size_t new_size) {
+
+    if (!old_ptr || old_size == 0) {
+        return allocate_bytes<Align>(new_size);
+    }
+
+    // The last allocation grows or shrinks in place
+    size_t old_offset = offset_of(old_ptr);
+    if (old_offset == prev_used) {
+        if (new_size > Capacity - prev_used) {
+            return std::unexpected(AllocError::OutOfMemory);
+        }
+        used = prev_used + new_size;
+        if constexpr (Zero == ZeroPolicy::OnAllocate) {
+            if (new_size > old_size) {
+                std::fill_n(storage + prev_used + old_size, new_size - old_size, uint8_t(0));
+            }
+        }
+        return old_ptr;
+    }
+
+    auto new_mem = allocate_bytes<Align>(new_size);
+    if (!new_mem) {
+        return std::unexpected(new_mem.error());
+    }
+
+    // Copy old data to new memory, limited by the smaller of the two sizes
+    std::copy_n(old_ptr, old_size < new_size ? old_size : new_size, new_mem.value());
+    return new_mem;
+}
+
+} // namespace alloc
@@ -0,0 +1,213 @@
+// src/LinearAllocator/ThreadArena.hpp
+#pragma once
+
+#include <atomic>
+#include "LinearAllocator.hpp"
+#include "ConcurrentLinearAllocator.hpp"
+
+namespace alloc {
+
+/**
+ * @brief Index used to mark the end of a block list
+ */
+inline constexpr uint32_t kNoBlock = UINT32_MAX;
+
+/**
+ * @brief A shared, lock-free pool of fixed-size memory blocks
+ *
+ * Free blocks form a Treiber stack whose links live in a side array, so the block
+ * memory itself is never touched by the pool. The head packs a 32-bit ABA tag with
+ * a 32-bit block index into a single 64-bit word.
+ *
+ * The pool also carries the global epoch used by ThreadArena: advancing it makes
+ * every thread arena drop its allocations the next time it allocates.
+ */
+struct BlockPool {
+    uint8_t* memory;                 ///< Memory of all blocks, block i starts at i * block_size
+    size_t block_size;               ///< Size of every block in bytes (multiple of the cache line size)
+    uint32_t block_count;            ///< Number of blocks in the pool
+    std::atomic<uint32_t>* links;    ///< Next free block of each free block, or the owner's chain link
+    alignas(kCacheLineSize) std::atomic<uint64_t> free_head; ///< ABA tag (high) and first free block (low)
+    alignas(kCacheLineSize) std::atomic<uint64_t> epoch;     ///< Global epoch, see epoch_reset()
+
+    /**
+     * @brief Construct a pool over existing block memory and link array
+     *
+     * @param memory_ptr Memory for block_count blocks of block_bytes each
+     * @param block_bytes Size of every block in bytes
+     * @param count Number of blocks
+     * @param link_array One link per block
+     */
+    BlockPool(uint8_t* memory_ptr, size_t block_bytes, uint32_t count,
+              std::atomic<uint32_t>* link_array);
+
+    /**
+     * @brief Move a pool that is not shared yet
+     */
+    BlockPool(BlockPool&& other) noexcept
+        : memory(other.memory), block_size(other.block_size),
+          block_count(other.block_count), links(other.links),
+          free_head(other.free_head.load(std::memory_order_relaxed)),
+          epoch(other.epoch.load(std::memory_order_relaxed)) {}
+
+    /**
+     * @brief Create a new Block Pool
+     *
+     * @param block_bytes Size of every block, rounded up to a multiple of the cache line size
+     * @param count Number of blocks in the pool
+     * @return std::expected<BlockPool, AllocError> A new pool or an error
+     */
+    static std::expected<BlockPool, AllocError> create(size_t block_bytes, uint32_t count);
+
+    /**
+     * @brief Take a block from the pool
+     *
+     * @return std::expected<uint32_t, AllocError> Index of the block or OutOfMemory when empty
+     */
+    std::expected<uint32_t, AllocError> acquire();
+
+    /**
+     * @brief Give a chain of blocks back to the pool with a single compare-and-swap
+     *
+     * @param first First block of the chain
+     * @param last Last block of the chain, its link is overwritten
+     */
+    void release_chain(uint32_t first, uint32_t last);
+
+    /**
+     * @brief Get the memory of a block
+     */
+    uint8_t* block_data(uint32_t index) {
+        return memory + static_cast<size_t>(index) * block_size;
+    }
+
+    /**
+     * @brief Start a new epoch, resetting every ThreadArena drawing from this pool
+     *
+     * Each thread arena notices the new epoch on its next allocation and hands its
+     * blocks back first. All allocations made before the call must be dead.
+     */
+    void epoch_reset() {
+        epoch.fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    /**
+     * @brief Free the block memory and the link array
+     */
+    void destroy();
+};
+
+/**
+ * @brief Per-thread arena front-end drawing its memory from a shared BlockPool
+ *
+ * Meant to be declared `thread_local`. Allocation goes to a LinearAllocator bound
+ * to the block the thread currently owns, so the fast path only touches thread
+ * private state plus a read of the pool epoch, which is written only by
+ * epoch_reset(). The shared free list is touched only when a block is full or on
+ * reset.
+ */
+struct ThreadArena {
+    LinearAllocator arena; ///< Allocator bound to the current block
+    BlockPool* pool;       ///< Pool the blocks come from
+    uint32_t held_first;   ///< Most recently acquired block (head of the held chain)
+    uint32_t held_last;    ///< First acquired block (tail of the held chain)
+    uint64_t epoch;        ///< Pool epoch the held allocations belong to
+
+    /**
+     * @brief Create a thread arena that has not acquired any block yet
+     *
+     * @param block_pool Pool to draw blocks from
+     * @param zero_memory Whether to zero memory on allocation
+     */
+    explicit ThreadArena(BlockPool& block_pool, bool zero_memory = true)
+        : arena(nullptr, 0, zero_memory), pool(&block_pool),
+          held_first(kNoBlock), held_last(kNoBlock),
+          epoch(block_pool.epoch.load(std::memory_order_acquire)) {}
+
+    ThreadArena(const ThreadArena&) = delete;
+    ThreadArena& operator=(const ThreadArena&) = delete;
+
+    /**
+     * @brief Give every held block back to the pool
+     */
+    ~ThreadArena() {
+        reset();
+    }
+
+    /**
+     * @brief Allocate memory with a specified alignment
+     *
+     * @tparam T The type to allocate for
+     * @param count The number of elements to allocate
+     * @param alignment The alignment required (must be a power of 2)
+     * @return std::expected<T*, AllocError> Pointer to the allocated memory or an error
+     */
+    template <typename T>
+    std::expected<T*, AllocError> allocate(size_t count = 1, size_t alignment = alignof(T)
+                                           LINEAR_ALLOCATOR_CALLSITE_DECL);
+
+    /**
+     * @brief Allocate uninitialized memory with a specified alignment
+     *
+     * Requests larger than the pool's block size fail with OutOfMemory.
+     *
+     * @param size_in_bytes The size to allocate in bytes
+     * @param alignment The alignment required (must be a power of 2)
+     * @return std::expected<void*, AllocError> Pointer to the allocated memory or an error
+     */
+    std::expected<void*, AllocError> allocate_bytes(size_t size_in_bytes,
+                                                   size_t alignment = alignof(std::max_align_t)
+                                                   LINEAR_ALLOCATOR_CALLSITE_DECL) {
+        if (epoch != pool->epoch.load(std::memory_order_acquire)) {
+            reset();
+        }
+
+        auto result = arena.allocate_bytes(size_in_bytes, alignment LINEAR_ALLOCATOR_CALLSITE_ARG);
+        if (result || result.error() != AllocError::OutOfMemory) {
+            return result;
+        }
+        return allocate_from_new_block(size_in_bytes, alignment LINEAR_ALLOCATOR_CALLSITE_ARG);
+    }
+
+    /**
+     * @brief Allocate and construct an object, see LinearAllocator::make
+     *
+     * The destructor list is kept in `arena` and spans blocks.
+     *
+     * @tparam T The type to construct
+     * @param args Arguments forwarded to the constructor
+     * @return std::expected<T*, AllocError> Pointer to the new object or an error
+     */
+    template <typename T, typename... Args>
+    std::expected<T*, AllocError> make(Args&&... args);
+
+    /**
+     * @brief Allocate and construct an array of objects, see LinearAllocator::make_array
+     *
+     * @tparam T The type to construct
+     * @param count The number of elements
+     * @param args Arguments passed to every element's constructor
+     * @return std::expected<T*, AllocError> Pointer to the first element or an error
+     */
+    template <typename T, typename... Args>
+    std::expected<T*, AllocError> make_array(size_t count, const Args&... args);
+
+    /**
+     * @brief Reset this thread's arena, handing every held block back to the pool
+     *
+     * Destructors registered by make() and make_array() run first.
+     */
+    void reset();
+
+    /**
+     * @brief Slow path of allocate_bytes: acquire a fresh block and allocate from it
+     */
+    std::expected<void*, AllocError> allocate_from_new_block(size_t size_in_bytes,
+                                                             size_t alignment
+                                                             LINEAR_ALLOCATOR_CALLSITE_PARAM);
+};
+
+} // namespace alloc
+
+// Include template implementation
+#include "ThreadArena.tpp"
@@ -0,0 +1,216 @@
+// src/LinearAllocator/ThreadArena.tpp
+#pragma once
+
+#include <cstdlib>
+#include <new>
+
+namespace alloc {
+
+inline BlockPool::BlockPool(uint8_t* memory_ptr, size_t block_bytes, uint32_t count,
+                            std::atomic<uint32_t>* link_array)
+    : memory(memory_ptr), block_size(block_bytes), block_count(count),
+      links(link_array), free_head(count == 0 ? kNoBlock : 0), epoch(0) {
+
+    // Initially every block is free, linked in address order
+    for (uint32_t i = 0; i < count; i++) {
+        links[i].store(i + 1 < count ? i + 1 : kNoBlock, std::memory_order_relaxed);
+    }
+}
+
+inline std::expected<BlockPool, AllocError> BlockPool::create(size_t block_bytes, uint32_t count) {
+    if (block_bytes == 0 || count == 0 || count == kNoBlock) {
+        return std::unexpected(AllocError::OutOfMemory);
+    }
+
+    // Round blocks to whole cache lines so two threads never share a line
+    block_bytes = (block_bytes + kCacheLineSize - 1) & ~(kCacheLineSize - 1);
+    if (block_bytes > SIZE_MAX / count) {
+        return std::unexpected(AllocError::OutOfMemory);
+    }
+
+    uint8_t* mem = static_cast<uint8_t*>(std::aligned_alloc(kCacheLineSize, block_bytes * count));
+    if (!mem) {
+        return std::unexpected(AllocError::OutOfMemory);
+    }
+
+    void* link_mem = std::malloc(sizeof(std::atomic<uint32_t>) * count);
+    if (!link_mem) {
+        std::free(mem);
+        return std::unexpected(AllocError::OutOfMemory);
+    }
+
+    auto* link_array = static_cast<std::atomic<uint32_t>*>(link_mem);
+    for (uint32_t i = 0; i < count; i++) {
+        new (&link_array[i]) std::atomic<uint32_t>(kNoBlock);
+    }
+
+    return BlockPool(mem, block_bytes, count, link_array);
+}
+
+inline std::expected<uint32_t, AllocError> BlockPool::acquire() {
+    uint64_t head = free_head.load(std::memory_order_acquire);
+
+    for (;;) {
+        uint32_t index = static_cast<uint32_t>(head);
+        if (index == kNoBlock) {
+            return std::unexpected(AllocError::OutOfMemory);
+        }
+
+        // The link may be stale if another thread popped this block meanwhile;
+        // the tag then differs and the compare-and-swap fails.
+        uint32_t next = links[index].load(std::memory_order_relaxed);
+        uint64_t new_head = (((head >> 32) + 1) << 32) | next;
+        if (free_head.compare_exchange_weak(head, new_head,
+                                            std::memory_order_acquire,
+                                            std::memory_order_acquire)) {
+            return index;
+        }
+    }
+}
+
+inline void BlockPool::release_chain(uint32_t first, uint32_t last) {
+    uint64_t head = free_head.load(std::memory_order_relaxed);
+    uint64_t new_head;
+
+    do {
+        links[last].store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+        new_head = (((head >> 32) + 1) << 32) | first;
+    } while (!free_head.compare_exchange_weak(head, new_head,
+                                              std::memory_order_release,
+                                              std::memory_order_relaxed));
+}
+
+inline void BlockPool::destroy() {
+    unpoison_memory(memory, block_size * block_count);
+    std::free(memory);
+    std::free(links);
+    memory = nullptr;
+    links = nullptr;
+    block_count = 0;
+    free_head.store(kNoBlock, std::memory_order_relaxed);
+}
+
+inline std::expected<void*, AllocError> ThreadArena::allocate_from_new_block(
+    size_t size_in_bytes, size_t alignment LINEAR_ALLOCATOR_CALLSITE_PARAM) {
+
+    // Blocks are cache line aligned, so smaller alignments need no padding
+    size_t padding = (alignment > kCacheLineSize ? alignment - 1 : 0) + kRedzoneBytes;
+    if (size_in_bytes > pool->block_size || padding > pool->block_size - size_in_bytes) {
+        return std::unexpected(AllocError::OutOfMemory);
+    }
+
+    auto block = pool->acquire();
+    if (!block) {
+        return std::unexpected(block.error());
+    }
+
+#ifdef LINEAR_ALLOCATOR_DEBUG
+    // The guard chain of the block being left is checked now; reset() gives the block back whole
+    size_t bad_offset = kNoGuard;
+    if (!check_guards(arena.buffer, arena.last_guard, bad_offset)) {
+        report_guard_corruption(arena.buffer, bad_offset);
+    }
+#endif
+
+    // Chain the block in front of the ones this thread already holds
+    uint32_t index = block.value();
+    pool->links[index].store(held_first, std::memory_order_relaxed);
+    held_first = index;
+    if (held_last == kNoBlock) {
+        held_last = index;
+    }
+
+    arena.buffer = pool->block_data(index);
+    arena.capacity = pool->block_size;
+    arena.used = 0;
+    arena.prev_used = 0;
+    arena.known_zero_offset = pool->block_size; // Recycled blocks can hold stale data
+#ifdef LINEAR_ALLOCATOR_DEBUG
+    arena.last_guard = kNoGuard;
+#endif
+
+    return arena.allocate_bytes(size_in_bytes, alignment LINEAR_ALLOCATOR_CALLSITE_ARG);
+}
+
+template <typename T>
+inline std::expected<T*, AllocError> ThreadArena::allocate(size_t count,
+                                                         size_t alignment LINEAR_ALLOCATOR_CALLSITE_PARAM) {
+    if (count == 0) {
+        return static_cast<T*>(nullptr);
+    }
+
+    auto result = allocate_bytes(count * sizeof(T), alignment LINEAR_ALLOCATOR_CALLSITE_ARG);
+    if (!result) {
+        return std::unexpected(result.error());
+    }
+
+    return static_cast<T*>(result.value());
+}
+
+template <typename T, typename... Args>
+inline std::expected<T*, AllocError> ThreadArena::make(Args&&... args) {
+    DestructorNode* node;
+    auto storage = allocate_tracked<T>(*this, arena.destructors, 1, node);
+    if (!storage) {
+        return storage;
+    }
+
+    T* object = new (storage.value()) T(std::forward<Args>(args)...);
+    if (node) {
+        node->count = 1;
+    }
+    return object;
+}
+
+template <typename T, typename... Args>
+inline std::expected<T*, AllocError> ThreadArena::make_array(
+    size_t count, const Args&... args) {
+
+    if (count == 0) {
+        return static_cast<T*>(nullptr);
+    }
+
+    DestructorNode* node;
+    auto storage = allocate_tracked<T>(*this, arena.destructors, count, node);
+    if (!storage) {
+        return storage;
+    }
+
+    T* objects = storage.value();
+    for (size_t i = 0; i < count; i++) {
+        new (objects + i) T(args...);
+        if (node) {
+            node->count = i + 1;
+        }
+    }
+    return objects;
+}
+
+inline void ThreadArena::reset() {
+    arena.run_destructors(nullptr);
+
+#ifdef LINEAR_ALLOCATOR_DEBUG
+    arena.debug_release(0);
+    if (held_first != kNoBlock) {
+        // Blocks left earlier had their guards checked then, fill and poison all of them
+        uint32_t index = pool->links[held_first].load(std::memory_order_relaxed);
+        while (index != kNoBlock) {
+            LinearAllocator left(pool->block_data(index), pool->block_size, false);
+            left.used = pool->block_size;
+            left.debug_release(0);
+            index = pool->links[index].load(std::memory_order_relaxed);
+        }
+    }
+#endif
+
+    if (held_first != kNoBlock) {
+        pool->release_chain(held_first, held_last);
+        held_first = kNoBlock;
+        held_last = kNoBlock;
+    }
+
+    arena = LinearAllocator(nullptr, 0, arena.zero_on_alloc);
+    epoch = pool->epoch.load(std::memory_order_acquire);
+}
+
+} // namespace alloc
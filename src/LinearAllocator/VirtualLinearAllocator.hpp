@@ -0,0 +1,141 @@
+// src/LinearAllocator/VirtualLinearAllocator.hpp
+#pragma once
+
+#include "LinearAllocator.hpp"
+#include "ArenaPlacement.hpp"
+
+namespace alloc {
+
+/**
+ * @brief A linear allocator over a reserved virtual address range (POSIX only)
+ *
+ * `create` only reserves address space with `mmap(PROT_NONE)`, so startup is
+ * constant-time regardless of the size. Pages are committed in steps of
+ * `commit_step` bytes as `used` advances, and `reset()` decommits everything past
+ * `retain_on_reset` with `madvise(MADV_DONTNEED)`, so resident memory follows
+ * real usage.
+ *
+ * The committed prefix is exposed through a regular LinearAllocator (its
+ * `capacity` is the committed size), so the allocation fast path is unchanged.
+ */
+struct VirtualLinearAllocator {
+    LinearAllocator arena;  ///< Allocator over the committed prefix of the reservation
+    size_t reserved;        ///< Size of the reserved address range in bytes
+    size_t commit_step;     ///< Granularity of commits, a multiple of the page size
+    size_t retain_on_reset; ///< Committed bytes kept by reset(), the rest is decommitted
+
+    /**
+     * @brief Create a new Virtual Linear Allocator
+     *
+     * @param reserve_bytes Size of the address range to reserve
+     * @param zero_memory Whether to zero memory on allocation
+     * @param commit_bytes Granularity of commits, rounded up to the page size
+     * @param retain_bytes Committed bytes kept across reset(), rounded up to commit_bytes
+     * @param placement Huge page and NUMA placement; Explicit huge pages are treated as
+     *                  Transparent because MAP_HUGETLB pages cannot be committed incrementally
+     * @return std::expected<VirtualLinearAllocator, AllocError> A new allocator or an error
+     */
+    static std::expected<VirtualLinearAllocator, AllocError> create(
+        size_t reserve_bytes, bool zero_memory = true,
+        size_t commit_bytes = size_t(64) * 1024, size_t retain_bytes = size_t(1024) * 1024,
+        const PlacementOptions& placement = {});
+
+    /**
+     * @brief Allocate memory with a specified alignment
+     *
+     * @tparam T The type to allocate for
+     * @param count The number of elements to allocate
+     * @param alignment The alignment required (must be a power of 2)
+     * @return std::expected<T*, AllocError> Pointer to the allocated memory or an error
+     */
+    template <typename T>
+    std::expected<T*, AllocError> allocate(size_t count = 1, size_t alignment = alignof(T)
+                                           LINEAR_ALLOCATOR_CALLSITE_DECL);
+
+    /**
+     * @brief Allocate uninitialized memory with a specified alignment
+     *
+     * @param size_in_bytes The size to allocate in bytes
+     * @param alignment The alignment required (must be a power of 2)
+     * @return std::expected<void*, AllocError> Pointer to the allocated memory or an error
+     */
+    std::expected<void*, AllocError> allocate_bytes(size_t size_in_bytes,
+                                                   size_t alignment = alignof(std::max_align_t)
+                                                   LINEAR_ALLOCATOR_CALLSITE_DECL) {
+        auto result = arena.allocate_bytes(size_in_bytes, alignment LINEAR_ALLOCATOR_CALLSITE_ARG);
+        if (result || result.error() != AllocError::OutOfMemory) {
+            return result;
+        }
+        return commit_and_allocate(size_in_bytes, alignment LINEAR_ALLOCATOR_CALLSITE_ARG);
+    }
+
+    /**
+     * @brief Allocate and construct an object, see LinearAllocator::make
+     *
+     * Pages are committed as needed, like allocate().
+     *
+     * @tparam T The type to construct
+     * @param args Arguments forwarded to the constructor
+     * @return std::expected<T*, AllocError> Pointer to the new object or an error
+     */
+    template <typename T, typename... Args>
+    std::expected<T*, AllocError> make(Args&&... args);
+
+    /**
+     * @brief Allocate and construct an array of objects, see LinearAllocator::make_array
+     *
+     * @tparam T The type to construct
+     * @param count The number of elements
+     * @param args Arguments passed to every element's constructor
+     * @return std::expected<T*, AllocError> Pointer to the first element or an error
+     */
+    template <typename T, typename... Args>
+    std::expected<T*, AllocError> make_array(size_t count, const Args&... args);
+
+    /**
+     * @brief Resize the last allocation made, committing more pages if needed
+     *
+     * @tparam T The type of the allocation
+     * @param old_ptr Pointer to the old memory
+     * @param old_count Old element count
+     * @param new_count New element count
+     * @param alignment Alignment requirements
+     * @return std::expected<T*, AllocError> Pointer to resized memory or an error
+     */
+    template <typename T>
+    std::expected<T*, AllocError> resize(T* old_ptr, size_t old_count,
+                                         size_t new_count,
+                                         size_t alignment = alignof(T)
+                                         LINEAR_ALLOCATOR_CALLSITE_DECL);
+
+    /**
+     * @brief Reset the allocator and decommit pages past the retained size
+     *
+     * Destructors registered by make() and make_array() run first.
+     */
+    void reset();
+
+    /**
+     * @brief Run registered destructors and release the whole reservation
+     */
+    void destroy();
+
+    /**
+     * @brief Make sure the first `end` bytes of the reservation are committed
+     *
+     * @param end Number of bytes from the start of the reservation that must be usable
+     * @return bool False if `end` exceeds the reservation or the commit failed
+     */
+    bool commit(size_t end);
+
+    /**
+     * @brief Slow path of allocate_bytes: commit enough pages and retry
+     */
+    std::expected<void*, AllocError> commit_and_allocate(size_t size_in_bytes, size_t alignment
+                                                         LINEAR_ALLOCATOR_CALLSITE_PARAM);
+};
+
+} // namespace alloc
+
+// Include template implementation
+#include "VirtualLinearAllocator.tpp"
@@ -0,0 +1,193 @@
+// src/LinearAllocator/VirtualLinearAllocator.tpp
+#pragma once
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace alloc {
+
+inline std::expected<VirtualLinearAllocator, AllocError> VirtualLinearAllocator::create(
+    size_t reserve_bytes, bool zero_memory, size_t commit_bytes, size_t retain_bytes,
+    const PlacementOptions& placement) {
+
+    if (reserve_bytes == 0) {
+        return std::unexpected(AllocError::OutOfMemory);
+    }
+
+    size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    if (placement.huge_pages == HugePages::Transparent ||
+        placement.huge_pages == HugePages::Explicit) {
+        // Commit whole huge pages so each commit can be backed by one
+        page_size = huge_page_size();
+    }
+    if (commit_bytes < page_size) {
+        commit_bytes = page_size;
+    }
+    commit_bytes = round_up_to(commit_bytes, page_size);
+    reserve_bytes = round_up_to(reserve_bytes, commit_bytes);
+    retain_bytes = round_up_to(retain_bytes, commit_bytes);
+    if (retain_bytes > reserve_bytes) {
+        retain_bytes = reserve_bytes;
+    }
+
+    // Reserve address space only, nothing is committed or touched yet. Huge page
+    // and NUMA policies set on the reservation apply to pages committed later.
+    auto region = map_region(reserve_bytes, placement, false);
+    if (!region) {
+        return std::unexpected(region.error());
+    }
+
+    // Fresh anonymous pages read as zero, so the known-zero watermark starts at 0
+    return VirtualLinearAllocator{
+        LinearAllocator(region->base, 0, zero_memory),
+        region->size,
+        commit_bytes,
+        retain_bytes
+    };
+}
+
+inline bool VirtualLinearAllocator::commit(size_t end) {
+    if (end <= arena.capacity) {
+        return true;
+    }
+    if (end > reserved) {
+        return false;
+    }
+
+    size_t new_committed = round_up_to(end, commit_step);
+    if (new_committed > reserved) {
+        new_committed = reserved;
+    }
+
+    if (mprotect(arena.buffer + arena.capacity, new_committed - arena.capacity,
+                 PROT_READ | PROT_WRITE) != 0) {
+        return false;
+    }
+
+    arena.capacity = new_committed;
+    return true;
+}
+
+inline std::expected<void*, AllocError> VirtualLinearAllocator::commit_and_allocate(
+    size_t size_in_bytes, size_t alignment LINEAR_ALLOCATOR_CALLSITE_PARAM) {
+
+    // Worst case end of the allocation, including alignment padding
+    if (size_in_bytes > reserved || kRedzoneBytes + alignment - 1 > reserved - size_in_bytes) {
+        return std::unexpected(AllocError::OutOfMemory);
+    }
+    size_t end = arena.used + kRedzoneBytes + alignment - 1 + size_in_bytes;
+    if (end > reserved) {
+        end = reserved;
+    }
+
+    if (!commit(end)) {
+        return std::unexpected(AllocError::OutOfMemory);
+    }
+    return arena.allocate_bytes(size_in_bytes, alignment LINEAR_ALLOCATOR_CALLSITE_ARG);
+}
+
+template <typename T>
+inline std::expected<T*, AllocError> VirtualLinearAllocator::allocate(
+    size_t count, size_t alignment LINEAR_ALLOCATOR_CALLSITE_PARAM) {
+
+    if (count == 0) {
+        return static_cast<T*>(nullptr);
+    }
+
+    auto result = allocate_bytes(count * sizeof(T), alignment LINEAR_ALLOCATOR_CALLSITE_ARG);
+    if (!result) {
+        return std::unexpected(result.error());
+    }
+
+    return static_cast<T*>(result.value());
+}
+
+template <typename T, typename... Args>
+inline std::expected<T*, AllocError> VirtualLinearAllocator::make(Args&&... args) {
+    DestructorNode* node;
+    auto storage = allocate_tracked<T>(*this, arena.destructors, 1, node);
+    if (!storage) {
+        return storage;
+    }
+
+    T* object = new (storage.value()) T(std::forward<Args>(args)...);
+    if (node) {
+        node->count = 1;
+    }
+    return object;
+}
+
+template <typename T, typename... Args>
+inline std::expected<T*, AllocError> VirtualLinearAllocator::make_array(
+    size_t count, const Args&... args) {
+
+    if (count == 0) {
+        return static_cast<T*>(nullptr);
+    }
+
+    DestructorNode* node;
+    auto storage = allocate_tracked<T>(*this, arena.destructors, count, node);
+    if (!storage) {
+        return storage;
+    }
+
+    T* objects = storage.value();
+    for (size_t i = 0; i < count; i++) {
+        new (objects + i) T(args...);
+        if (node) {
+            node->count = i + 1;
+        }
+    }
+    return objects;
+}
+
+template <typename T>
+inline std::expected<T*, AllocError> VirtualLinearAllocator::resize(
+    T* old_ptr, size_t old_count, size_t new_count, size_t alignment LINEAR_ALLOCATOR_CALLSITE_PARAM) {
+
+    auto result = arena.resize<T>(old_ptr, old_count, new_count, alignment LINEAR_ALLOCATOR_CALLSITE_ARG);
+    if (result || result.error() != AllocError::OutOfMemory) {
+        return result;
+    }
+
+    // Commit enough for an in-place grow of the last allocation, or for a copy
+    size_t new_size = new_count * sizeof(T);
+    bool is_last = old_ptr && old_count != 0 &&
+                   reinterpret_cast<uint8_t*>(old_ptr) == arena.buffer + arena.prev_used;
+    size_t start = is_last ? arena.prev_used : arena.used + kRedzoneBytes + alignment - 1;
+    if (start > reserved || new_size > reserved - start || !commit(start + new_size)) {
+        return std::unexpected(AllocError::OutOfMemory);
+    }
+
+    return arena.resize<T>(old_ptr, old_count, new_count, alignment LINEAR_ALLOCATOR_CALLSITE_ARG);
+}
+
+inline void VirtualLinearAllocator::reset() {
+    arena.reset();
+
+    // Give pages past the retained size back to the OS
+    if (arena.capacity > retain_on_reset) {
+        uint8_t* start = arena.buffer + retain_on_reset;
+        size_t length = arena.capacity - retain_on_reset;
+        madvise(start, length, MADV_DONTNEED);
+        mprotect(start, length, PROT_NONE);
+        arena.capacity = retain_on_reset;
+
+        // Decommitted pages come back as fresh zero pages
+        if (arena.known_zero_offset > retain_on_reset) {
+            arena.known_zero_offset = retain_on_reset;
+        }
+    }
+}
+
+inline void VirtualLinearAllocator::destroy() {
+    arena.run_destructors(nullptr);
+    if (arena.buffer) {
+        arena.unpoison();
+        munmap(arena.buffer, reserved);
+    }
+    arena = LinearAllocator(nullptr, 0, arena.zero_on_alloc);
+    reserved = 0;
+}
+
+} // namespace alloc
@@ -0,0 +1,359 @@
+// tools/arena_replay.cpp
+#include <fmt/core.h>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../src/LinearAllocator/GrowingLinearAllocator.hpp"
+#include "../src/LinearAllocator/SegregatedArena.hpp"
+
+/**
+ * @brief Replays an allocation trace against other arena configurations
+ *
+ * Usage: arena_replay <trace> [--capacity BYTES] [--growing BLOCK_BYTES] [--segregated CHUNK_BYTES]
+ *
+ * Every option can be repeated. Without options the trace is replayed with the
+ * capacity each arena was recorded with, a growing arena with 64KB blocks and a
+ * segregated arena with 16KB chunks. Events of every arena are replayed in the
+ * order they were recorded, each arena on a fresh allocator of the configuration.
+ */
+
+/**
+ * @brief Result of replaying one arena's events
+ */
+struct ReplayResult {
+    size_t peak_live = 0;      ///< Most requested bytes live at once
+    size_t peak_footprint = 0; ///< Most memory the configuration held at once
+    size_t failures = 0;       ///< Requests the configuration could not serve
+    double ns = 0.0;           ///< Time spent replaying
+};
+
+/**
+ * @brief One LinearAllocator of a fixed capacity
+ */
+struct PlainModel {
+    using Savepoint = alloc::TempArenaMemory;
+    alloc::LinearAllocator arena;
+
+    explicit PlainModel(size_t capacity)
+        : arena(static_cast<uint8_t*>(std::malloc(capacity)), capacity, false) {}
+    ~PlainModel() { std::free(arena.buffer); }
+
+    std::expected<void*, alloc::AllocError> allocate(size_t size, size_t alignment) {
+        return arena.allocate_bytes(size, alignment);
+    }
+    std::expected<void*, alloc::AllocError> resize(void* last, size_t old_size, size_t new_size,
+                                                   size_t alignment) {
+        auto result = arena.resize<uint8_t>(static_cast<uint8_t*>(last), old_size, new_size, alignment);
+        if (!result) {
+            return std::unexpected(result.error());
+        }
+        return result.value();
+    }
+    Savepoint* begin() { return new Savepoint(Savepoint::begin(arena)); }
+    void reset() { arena.reset(); }
+    size_t footprint() const { return arena.used; }
+};
+
+/**
+ * @brief A GrowingLinearAllocator with geometric growth
+ */
+struct GrowingModel {
+    using Savepoint = alloc::TempGrowingArenaMemory;
+    alloc::GrowingLinearAllocator arena;
+
+    explicit GrowingModel(size_t block_size)
+        : arena(alloc::GrowingLinearAllocator::create(block_size, alloc::GrowthPolicy::Geometric, false)
+                    .value()) {}
+    ~GrowingModel() { arena.destroy(); }
+
+    std::expected<void*, alloc::AllocError> allocate(size_t size, size_t alignment) {
+        return arena.allocate_bytes(size, alignment);
+    }
+    std::expected<void*, alloc::AllocError> resize(void* last, size_t old_size, size_t new_size,
+                                                   size_t alignment) {
+        auto result = arena.resize<uint8_t>(static_cast<uint8_t*>(last), old_size, new_size, alignment);
+        if (!result) {
+            return std::unexpected(result.error());
+        }
+        return result.value();
+    }
+    Savepoint* begin() { return new Savepoint(Savepoint::begin(arena)); }
+    void reset() { arena.reset(); }
+    size_t footprint() const { return arena.total_capacity(); }
+};
+
+/**
+ * @brief A SegregatedArena over a parent large enough for the whole trace
+ */
+struct SegregatedModel {
+    using Savepoint = alloc::SegregatedSavepoint;
+    alloc::LinearAllocator parent;
+    alloc::SegregatedArena arena;
+
+    SegregatedModel(size_t parent_capacity, size_t chunk_size)
+        : parent(static_cast<uint8_t*>(std::malloc(parent_capacity)), parent_capacity, false),
+          arena(parent, chunk_size, chunk_size / 32) {}
+    ~SegregatedModel() { std::free(parent.buffer); }
+
+    std::expected<void*, alloc::AllocError> allocate(size_t size, size_t alignment) {
+        return arena.allocate_bytes(size, alignment);
+    }
+    std::expected<void*, alloc::AllocError> resize(void*, size_t, size_t new_size, size_t alignment) {
+        // No in-place resize across buckets: the grown copy is a new allocation
+        return arena.allocate_bytes(new_size, alignment);
+    }
+    Savepoint* begin() { return new Savepoint(Savepoint::begin(arena)); }
+    void reset() { arena.reset(); }
+    size_t footprint() const { return arena.footprint(); }
+};
+
+/**
+ * @brief Savepoint on the replay allocator, with the recorded offset it stands for
+ */
+template <typename Model>
+struct OpenSavepoint {
+    uint64_t recorded_offset;                          ///< Offset recorded by TempBegin
+    std::unique_ptr<typename Model::Savepoint> savepoint; ///< Ends when destroyed
+    size_t live;                                       ///< Live requested bytes at the savepoint
+};
+
+/**
+ * @brief Replay one arena's events on a model
+ */
+template <typename Model>
+ReplayResult replay(Model& model, const std::vector<alloc::TraceEvent>& events) {
+    ReplayResult result;
+    std::vector<OpenSavepoint<Model>> open;
+    void* last = nullptr;
+    size_t live = 0;
+
+    // Nested savepoints must roll back innermost first
+    auto close_all = [&open] {
+        while (!open.empty()) {
+            open.pop_back();
+        }
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < events.size(); i++) {
+        const alloc::TraceEvent& event = events[i];
+        size_t alignment = size_t(1) << event.alignment_log2;
+        switch (static_cast<alloc::TraceKind>(event.kind)) {
+        case alloc::TraceKind::Allocate: {
+            // Arenas that grow retry a failed request right away; replay only the retry
+            if (!event.succeeded && i + 1 < events.size() && events[i + 1].kind == event.kind &&
+                events[i + 1].size == event.size) {
+                break;
+            }
+            auto allocated = model.allocate(event.size, alignment);
+            if (!allocated) {
+                result.failures++;
+                break;
+            }
+            last = allocated.value();
+            live += event.size;
+            break;
+        }
+        case alloc::TraceKind::Resize: {
+            bool retried = !event.succeeded && i + 1 < events.size() &&
+                           events[i + 1].kind == static_cast<uint8_t>(alloc::TraceKind::Allocate) &&
+                           events[i + 1].size == event.size;
+            if (!last || retried) {
+                break;
+            }
+            auto resized = model.resize(last, event.extra, event.size, alignment);
+            if (!resized) {
+                result.failures++;
+                break;
+            }
+            last = resized.value();
+            live = live + event.size >= event.extra ? live + event.size - event.extra : 0;
+            break;
+        }
+        case alloc::TraceKind::Reset:
+            close_all();
+            model.reset();
+            last = nullptr;
+            live = 0;
+            break;
+        case alloc::TraceKind::TempBegin:
+            open.push_back({event.size, std::unique_ptr<typename Model::Savepoint>(model.begin()), live});
+            break;
+        case alloc::TraceKind::TempEnd: {
+            // Rollbacks made without a TempBegin (SegregatedArena resetting its parent
+            // and buckets) match no open savepoint and are skipped
+            size_t match = open.size();
+            while (match > 0 && open[match - 1].recorded_offset != event.size) {
+                match--;
+            }
+            if (match == 0) {
+                break;
+            }
+            // Savepoints end innermost first; ones never ended are dropped on the way
+            while (open.size() >= match) {
+                live = open.back().live;
+                open.pop_back();
+            }
+            last = nullptr;
+            break;
+        }
+        }
+
+        if (live > result.peak_live) {
+            result.peak_live = live;
+        }
+        size_t footprint = model.footprint();
+        if (footprint > result.peak_footprint) {
+            result.peak_footprint = footprint;
+        }
+    }
+    close_all();
+    result.ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+/**
+ * @brief A configuration given on the command line
+ */
+struct Config {
+    enum Kind { Recorded, Capacity, Growing, Segregated } kind; ///< Allocator to replay on
+    size_t bytes; ///< Capacity, block size or chunk size
+};
+
+/**
+ * @brief Events of one recorded arena
+ */
+struct ArenaStream {
+    std::vector<alloc::TraceEvent> events; ///< Events in recorded order
+    size_t recorded_capacity = 0;          ///< Capacity seen in its Allocate events
+    size_t requested = 0;                  ///< Bytes requested by its successful allocations
+    size_t recorded_failures = 0;          ///< Allocations and resizes that failed when recorded
+};
+
+ReplayResult replay_stream(const Config& config, const ArenaStream& stream) {
+    switch (config.kind) {
+    case Config::Recorded: {
+        PlainModel model(stream.recorded_capacity ? stream.recorded_capacity : 1);
+        return replay(model, stream.events);
+    }
+    case Config::Capacity: {
+        PlainModel model(config.bytes);
+        return replay(model, stream.events);
+    }
+    case Config::Growing: {
+        GrowingModel model(config.bytes);
+        return replay(model, stream.events);
+    }
+    case Config::Segregated:
+    default: {
+        // Padding and chunk tails cannot take more than this
+        size_t parent = 2 * stream.requested + 64 * stream.events.size() + 8 * config.bytes;
+        SegregatedModel model(parent, config.bytes);
+        return replay(model, stream.events);
+    }
+    }
+}
+
+size_t waste(const ReplayResult& result) {
+    return result.peak_footprint > result.peak_live ? result.peak_footprint - result.peak_live : 0;
+}
+
+std::string config_name(const Config& config) {
+    switch (config.kind) {
+    case Config::Recorded: return "recorded capacity";
+    case Config::Capacity: return fmt::format("capacity {}", config.bytes);
+    case Config::Growing: return fmt::format("growing {}", config.bytes);
+    case Config::Segregated:
+    default: return fmt::format("segregated {}", config.bytes);
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fmt::print("Usage: {} <trace> [--capacity BYTES] [--growing BLOCK_BYTES] [--segregated CHUNK_BYTES]\n",
+                   argv[0]);
+        return 2;
+    }
+
+    std::vector<Config> configs;
+    for (int i = 2; i + 1 < argc; i += 2) {
+        size_t bytes = std::strtoull(argv[i + 1], nullptr, 10);
+        if (bytes == 0) {
+            fmt::print("Invalid size: {}\n", argv[i + 1]);
+            return 2;
+        }
+        if (std::strcmp(argv[i], "--capacity") == 0) {
+            configs.push_back({Config::Capacity, bytes});
+        } else if (std::strcmp(argv[i], "--growing") == 0) {
+            configs.push_back({Config::Growing, bytes});
+        } else if (std::strcmp(argv[i], "--segregated") == 0) {
+            configs.push_back({Config::Segregated, bytes});
+        } else {
+            fmt::print("Unknown option: {}\n", argv[i]);
+            return 2;
+        }
+    }
+    if (configs.empty()) {
+        configs = {{Config::Recorded, 0}, {Config::Growing, 64 * 1024}, {Config::Segregated, 16 * 1024}};
+    }
+
+    auto events = alloc::read_trace(argv[1]);
+    if (!events) {
+        fmt::print("Failed to read trace {}\n", argv[1]);
+        return 1;
+    }
+
+    // Split by arena, keeping the recorded order and the order arenas first appear
+    std::map<uint64_t, size_t> index_of;
+    std::vector<ArenaStream> streams;
+    for (const alloc::TraceEvent& event : events.value()) {
+        auto [it, inserted] = index_of.try_emplace(event.arena, streams.size());
+        if (inserted) {
+            streams.emplace_back();
+        }
+        ArenaStream& stream = streams[it->second];
+        stream.events.push_back(event);
+        if (event.kind == static_cast<uint8_t>(alloc::TraceKind::Allocate) && event.extra > stream.recorded_capacity) {
+            stream.recorded_capacity = event.extra;
+        }
+        if (!event.succeeded) {
+            stream.recorded_failures++;
+        } else if (event.kind == static_cast<uint8_t>(alloc::TraceKind::Allocate)) {
+            stream.requested += event.size;
+        }
+    }
+
+    fmt::print("{} events, {} arenas\n\n", events->size(), streams.size());
+    fmt::print("{:<6} {:>10} {:>14} {:>10}\n", "arena", "events", "capacity", "recorded OOM");
+    for (size_t i = 0; i < streams.size(); i++) {
+        fmt::print("{:<6} {:>10} {:>14} {:>10}\n", i, streams[i].events.size(), streams[i].recorded_capacity,
+                   streams[i].recorded_failures);
+    }
+
+    // Waste is memory held beyond the most bytes ever live at once
+    fmt::print("\n{:<22} {:<6} {:>12} {:>14} {:>12} {:>8} {:>10}\n", "configuration", "arena", "peak live",
+               "peak footprint", "waste", "OOM", "ns/event");
+    for (const Config& config : configs) {
+        ReplayResult total;
+        for (size_t i = 0; i < streams.size(); i++) {
+            ReplayResult result = replay_stream(config, streams[i]);
+            fmt::print("{:<22} {:<6} {:>12} {:>14} {:>12} {:>8} {:>10.1f}\n", config_name(config), i,
+                       result.peak_live, result.peak_footprint, waste(result), result.failures,
+                       result.ns / static_cast<double>(streams[i].events.size()));
+            total.peak_live += result.peak_live;
+            total.peak_footprint += result.peak_footprint;
+            total.failures += result.failures;
+            total.ns += result.ns;
+        }
+        if (streams.size() > 1) {
+            fmt::print("{:<22} {:<6} {:>12} {:>14} {:>12} {:>8} {:>10.1f}\n", config_name(config), "all",
+                       total.peak_live, total.peak_footprint, waste(total), total.failures,
+                       total.ns / static_cast<double>(events->size()));
+        }
+    }
+    return 0;
+}